@@ -0,0 +1,283 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_job.hpp>
+#include <problems/jsp/jsp_machine.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_solvers.hpp>
+#include <problems/jsp/jsp_task.hpp>
+#include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <utils/philox.hpp>
+#include <utils/thread_pool.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+// the durations are fuzzy, crisp instances are read as degenerate fuzzy numbers
+using JobType = JSPJob<double>;
+using MachineType = JSPMachine;
+using TaskType = JSPTask<TriangularFuzzyNumber<double>, JobType, MachineType>;
+using ProblemType = JSP<TaskType, JobType, MachineType>;
+
+/**
+ * @brief Configuration of the batch.
+ * 
+ */
+struct Configuration
+{
+    std::string solver_name = "memetic"; // name of the solver
+    std::string objective = "twt"; // objective to be minimized, makespan or twt
+    unsigned int replicas = 30; // replicas per instance
+    unsigned int threads = 0; // worker threads, 0 to use one per hardware thread
+    long time_limit = 0; // wall-clock time per replica in milliseconds, 0 for no limit
+    std::uint64_t seed = 0; // seed of the random number generator, each replica uses its own stream
+};
+
+/**
+ * @brief Instance of the batch.
+ * 
+ */
+struct Instance
+{
+    std::string path; // path of the instance
+    std::unique_ptr<ProblemType> problem; // problem, shared by all the replicas
+    double expected_cost; // estimation of the cost of a replica, only used to order the replicas
+    double lower_bound; // lower bound of the objective
+    std::vector<double> values; // objective value of each replica, NaN if the replica failed
+    std::vector<double> times; // wall-clock time of each replica in seconds
+};
+
+/**
+ * @brief Adds to a list the instances of a directory (recursively, in lexicographical order) or of a manifest
+ * (a file with a path per line, relative to the manifest; empty lines and lines starting with '#' are ignored).
+ * 
+ * @param paths list of instances.
+ * @param source directory or manifest.
+ */
+static void AddInstances(std::vector<std::string>& paths, const std::filesystem::path& source)
+{
+    if (std::filesystem::is_directory(source)) {
+        std::vector<std::string> found;
+        for (const auto& entry: std::filesystem::recursive_directory_iterator(source)) {
+            if (entry.is_regular_file()) {
+                found.push_back(entry.path().string());
+            }
+        }
+        std::sort(found.begin(), found.end());
+        paths.insert(paths.end(), found.begin(), found.end());
+    } else {
+        std::ifstream manifest(source);
+        if (!manifest) {
+            throw std::invalid_argument("cannot open " + source.string());
+        }
+        std::string line;
+        while (std::getline(manifest, line)) {
+            line.erase(line.find_last_not_of(" \t\r") + 1);
+            if (!line.empty() && line[0] != '#') {
+                std::filesystem::path path(line);
+                paths.push_back(path.is_absolute() ? line : (source.parent_path() / path).string());
+            }
+        }
+    }
+}
+
+/**
+ * @brief Runs all the replicas of all the instances. The replicas are submitted from the most to the least expensive,
+ * so the pool starts the long ones first and fills the end of the batch with the short ones, and each result is printed
+ * as soon as it is available.
+ * 
+ * @tparam Solution type of the solution.
+ * @param configuration configuration of the batch.
+ * @param instances instances of the batch, where the results are stored.
+ * @param os stream where the results are printed.
+ */
+template <typename Solution> static void RunBatch(const Configuration& configuration, std::vector<Instance>& instances, std::ostream& os)
+{
+    const auto solver = ParseJSPSolverType(configuration.solver_name);
+    std::vector<std::size_t> order(instances.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&instances](std::size_t a, std::size_t b) {
+        return instances[a].expected_cost > instances[b].expected_cost;
+    });
+
+    std::mutex output; // protects the stream and the results
+    std::vector<std::future<void>> futures;
+    ThreadPool pool(configuration.threads);
+    for (std::size_t i: order) {
+        Instance& instance = instances[i];
+        instance.lower_bound = JSPSolvers::LowerBound<Solution>(*instance.problem);
+        instance.values.resize(configuration.replicas);
+        instance.times.resize(configuration.replicas);
+        for (unsigned int replica = 0; replica < configuration.replicas; replica++) {
+            futures.push_back(pool.Submit([&configuration, &instance, &output, &os, solver, replica]() {
+                Philox4x32 rng(configuration.seed, replica);
+                SearchBudget budget =
+                    configuration.time_limit > 0 ? SearchBudget(std::chrono::milliseconds(configuration.time_limit)) : SearchBudget();
+                // a failed replica is reported and does not stop the rest of the batch
+                try {
+                    auto best = JSPSolvers::Solve<Solution>(solver, budget, IgnoreImprovements{}, *instance.problem, rng);
+                    double value = JSPSolvers::ObjectiveValue(best);
+                    double time = std::chrono::duration<double>(budget.Elapsed()).count();
+                    std::lock_guard<std::mutex> lock(output);
+                    instance.values[replica] = value;
+                    instance.times[replica] = time;
+                    os << instance.path << ',' << replica << ',' << value << ',' << time << std::endl;
+                } catch (const std::exception& e) {
+                    double time = std::chrono::duration<double>(budget.Elapsed()).count();
+                    std::lock_guard<std::mutex> lock(output);
+                    instance.values[replica] = std::numeric_limits<double>::quiet_NaN();
+                    instance.times[replica] = time;
+                    std::cerr << instance.path << ": replica " << replica << " failed: " << e.what() << std::endl;
+                }
+            }));
+        }
+    }
+    for (auto& future: futures) {
+        future.get();
+    }
+}
+
+/**
+ * @brief Prints the summary of an instance, with the same statistics as jobshop-replicas and the optimality gap of the best value.
+ * 
+ * @param os stream where the summary will be printed.
+ * @param instance instance with the results of its replicas.
+ */
+static void PrintSummary(std::ostream& os, const Instance& instance)
+{
+    // only the replicas that did not fail
+    std::vector<double> values;
+    std::vector<double> times;
+    for (std::size_t i = 0; i < instance.values.size(); i++) {
+        if (!std::isnan(instance.values[i])) {
+            values.push_back(instance.values[i]);
+            times.push_back(instance.times[i]);
+        }
+    }
+    if (values.empty()) {
+        os << instance.path << ": all the replicas failed" << std::endl;
+        return;
+    }
+    double best = *std::min_element(values.begin(), values.end());
+    double mean = 0;
+    double time = 0;
+    for (std::size_t i = 0; i < values.size(); i++) {
+        mean += values[i] / values.size();
+        time += times[i] / times.size();
+    }
+    double squares = 0;
+    for (double value: values) {
+        squares += (value - mean) * (value - mean);
+    }
+    double standard_deviation = values.size() > 1 ? std::sqrt(squares / (values.size() - 1)) : 0;
+    os << instance.path;
+    if (values.size() < instance.values.size()) {
+        os << " (" << instance.values.size() - values.size() << " failed replicas)";
+    }
+    os << ": Best = " << best << ", Average = " << mean << ", Standard deviation = " << standard_deviation
+       << ", Average execution time = " << time << ", Lower bound = " << instance.lower_bound
+       << ", Gap = " << JSPSolvers::Gap(best, instance.lower_bound) << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-batch [-s memetic|memetic-pr|memetic-ss|memetic-adaptive|ea|tabu|exact|auto] [-o makespan|twt] [-r replicas]
+    //                      [-j threads] [-t milliseconds] [-seed seed] (directory | manifest)...
+    // prints a CSV line (instance, replica, value, time in seconds) to std::cout as each replica finishes,
+    // and the summary of each instance and of the batch to std::cerr at the end
+    Configuration configuration;
+    configuration.seed = static_cast<std::uint64_t>(std::random_device{}()) << 32 | std::random_device{}();
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg.size() > 1 && arg[0] == '-' && i + 1 < argc) {
+            std::string value(argv[++i]);
+            if (arg == "-s") {
+                configuration.solver_name = value;
+            } else if (arg == "-o") {
+                configuration.objective = value;
+            } else if (arg == "-r") {
+                configuration.replicas = std::stoul(value);
+            } else if (arg == "-j") {
+                configuration.threads = std::stoul(value);
+            } else if (arg == "-t") {
+                configuration.time_limit = std::stol(value);
+            } else if (arg == "-seed") {
+                configuration.seed = std::stoull(value);
+            } else {
+                throw std::invalid_argument("unknown option " + arg);
+            }
+        } else {
+            AddInstances(paths, arg);
+        }
+    }
+    if (paths.empty()) {
+        throw std::invalid_argument("Missing instances");
+    }
+    if (configuration.replicas == 0) {
+        throw std::invalid_argument("at least one replica is needed");
+    }
+    if (configuration.objective != "makespan" && configuration.objective != "twt") {
+        throw std::invalid_argument("unknown objective " + configuration.objective);
+    }
+
+    // each instance is read once; a replica of the memetic algorithm evaluates populations of n*m individuals,
+    // each evaluation in time proportional to n*m, with tabu searches whose length grows with n+m
+    // (the files that cannot be read, like those in formats without a reader, are reported and skipped)
+    std::vector<Instance> instances;
+    for (const auto& path: paths) {
+        Instance instance;
+        instance.path = path;
+        try {
+            instance.problem = std::make_unique<ProblemType>(
+                JSPBinaryInstance::IsBinaryInstance(path) ? read_binary<TaskType, JobType, MachineType>(path)
+                : configuration.objective == "twt"        ? read_standard_due_dates_file<TaskType, JobType, MachineType>(path)
+                                                          : read_standard_file<TaskType, JobType, MachineType>(path));
+        } catch (const std::exception& e) {
+            std::cerr << path << ": skipped: " << e.what() << std::endl;
+            continue;
+        }
+        double tasks = instance.problem->GetNumberOfTasks();
+        instance.expected_cost = tasks * tasks * (instance.problem->GetNumberOfJobs() + instance.problem->GetNumberOfMachines());
+        instances.push_back(std::move(instance));
+    }
+    if (instances.empty()) {
+        throw std::invalid_argument("none of the instances can be read");
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::cout << "instance,replica,value,time" << std::endl;
+    if (configuration.objective == "twt") {
+        RunBatch<JSPTotalWeightedTardinessMinimizationSolution<ProblemType>>(configuration, instances, std::cout);
+    } else {
+        RunBatch<JSPMakespanMinimizationSolution<ProblemType>>(configuration, instances, std::cout);
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double work = 0;
+    for (const auto& instance: instances) {
+        PrintSummary(std::cerr, instance);
+        for (double time: instance.times) {
+            work += time;
+        }
+    }
+    std::cerr << "Seed = " << configuration.seed << ", wall-clock time = " << elapsed << ", total work = " << work << std::endl;
+    return 0;
+}
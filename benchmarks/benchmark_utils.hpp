@@ -0,0 +1,70 @@
+/**
+ * @file benchmark_utils.hpp
+ * @author Pablo
+ * @brief Utilities shared by the benchmarks.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef BENCHMARKUTILS_HPP_
+#define BENCHMARKUTILS_HPP_
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include <problems/jsp/jsp.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_job.hpp>
+#include <problems/jsp/jsp_machine.hpp>
+#include <problems/jsp/jsp_task.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+// types of the problems with crisp and fuzzy durations
+using CrispJobType = JSPJob<int>;
+using CrispTaskType = JSPTask<int, CrispJobType, JSPMachine>;
+using CrispProblemType = JSP<CrispTaskType, CrispJobType, JSPMachine>;
+using FuzzyJobType = JSPJob<double>;
+using FuzzyTaskType = JSPTask<TriangularFuzzyNumber<double>, FuzzyJobType, JSPMachine>;
+using FuzzyProblemType = JSP<FuzzyTaskType, FuzzyJobType, JSPMachine>;
+
+/**
+ * @brief Prevents the compiler from removing the computation of a value that is not used.
+ * 
+ * @tparam T type of the value.
+ * @param value value to be kept.
+ */
+template <typename T> inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Checks if an instance has fuzzy durations, that are written as triples "(a,b,c)" in the text instances
+ * and marked with a flag in the binary instances.
+ * 
+ * @param path path of the instance.
+ * @return true if the instance has fuzzy durations, false in other case.
+ */
+inline bool IsFuzzyInstance(const std::string& path)
+{
+    if (JSPBinaryInstance::IsBinaryInstance(path)) {
+        return JSPBinaryInstance(path).GetFlags() & JSPBinaryInstance::fuzzy;
+    }
+    std::ifstream is(path);
+    if (!is) {
+        throw std::invalid_argument("cannot open instance " + path);
+    }
+    return std::find(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>(), '(') != std::istreambuf_iterator<char>();
+}
+
+#endif /* BENCHMARKUTILS_HPP_ */
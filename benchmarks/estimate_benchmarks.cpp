@@ -0,0 +1,172 @@
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <benchmarks/benchmark_utils.hpp>
+#include <metaheuristics/tabu_search/tabu_search_variable_length.hpp>
+#include <metaheuristics/utils/estimate_telemetry.hpp>
+#include <metaheuristics/utils/local_search_logger.hpp>
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_generation_operators.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_move.hpp>
+#include <problems/jsp/jsp_neighborhoods.hpp>
+#include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <utils/philox.hpp>
+
+// instances measured when none is given in the command line, for each objective
+static const std::vector<std::string> default_makespan_instances = {"instances/jsp/standard_format/ft/ft10.txt",
+                                                                    "instances/jsp/standard_format/la/la21.txt",
+                                                                    "instances/jsp/standard_format/ta/ta21.txt",
+                                                                    "instances/fjsp/ft10.txt",
+                                                                    "instances/fjsp/la21.txt"};
+static const std::vector<std::string> default_twt_instances = {"instances/jsptwt/standard_format/ft/ft10_13.txt",
+                                                               "instances/jsptwt/standard_format/la/la21_13.txt",
+                                                               "instances/jsptwt/standard_format/ta/ta21_13.txt",
+                                                               "instances/fjsptwt/ft10_13.txt",
+                                                               "instances/fjsptwt/la21_13.txt"};
+
+/**
+ * @brief Configuration of the benchmark.
+ * 
+ */
+struct Configuration
+{
+    std::string objective = "makespan"; // objective of the solutions, makespan or twt
+    unsigned int iterations = 200; // iterations of each tabu search
+    unsigned int samples = 16; // moves evaluated exactly at each iteration
+    unsigned long long seed = 1; // seed of the random number generators
+};
+
+/**
+ * @brief Runs a tabu search with a neighborhood that estimates the objectives and prints a line with the accuracy of
+ * the estimates along the search.
+ * 
+ * @tparam Solution type of the solution.
+ * @tparam Neighborhood type of the neighborhood.
+ * @tparam Problem type of the problem.
+ * @param os stream where the results will be printed.
+ * @param configuration configuration of the benchmark.
+ * @param neighborhood name of the neighborhood.
+ * @param instance path of the instance.
+ * @param problem problem to be solved.
+ */
+template <typename Solution, typename Neighborhood, typename Problem>
+static void RunNeighborhood(std::ostream& os,
+                            const Configuration& configuration,
+                            const std::string& neighborhood,
+                            const std::string& instance,
+                            const Problem& problem)
+{
+    Philox4x32 rng(configuration.seed);
+    std::vector<Solution> initial_solution;
+    JSPRandomPopulationGenerator{}.template GetIndividuals<Solution>(std::back_inserter(initial_solution), problem, 1, rng);
+
+    EstimateTelemetry telemetry(configuration.samples, configuration.seed);
+    NullLocalSearchLogger<Solution> logger;
+    SearchBudget budget;
+    {
+        EstimateTelemetry::Scope scope(telemetry);
+        TabuSearchVariableLength::FindSolution(
+            logger,
+            budget,
+            [](const Solution&) {},
+            initial_solution.front(),
+            1,
+            problem.GetNumberOfJobs() + problem.GetNumberOfMachines(),
+            [&configuration](auto iterations, auto) { return iterations >= configuration.iterations; },
+            Neighborhood());
+    }
+
+    const double iterations = telemetry.GetIterations() > 0 ? telemetry.GetIterations() : 1;
+    const double samples = telemetry.GetSamples() > 0 ? telemetry.GetSamples() : 1;
+    os << configuration.objective << ',' << neighborhood << ',' << instance << ',' << telemetry.GetIterations() << ','
+       << telemetry.GetNeighborsPerIteration() << ',' << telemetry.GetSamples() << ','
+       << std::chrono::duration<double, std::micro>(budget.Elapsed() - telemetry.GetTime()).count() / iterations << ','
+       << std::chrono::duration<double, std::micro>(telemetry.GetTime()).count() / samples << ',' << telemetry.GetExactFraction() << ','
+       << telemetry.GetUnderestimateFraction() << ',' << telemetry.GetMeanAbsoluteError() << ',' << telemetry.GetErrorPercentile(0.05) << ','
+       << telemetry.GetErrorPercentile(0.5) << ',' << telemetry.GetErrorPercentile(0.95) << ',' << telemetry.GetRankCorrelation() << ','
+       << telemetry.GetMisrankedFraction() << ',' << telemetry.GetTopAgreement() << std::endl;
+}
+
+/**
+ * @brief Measures the accuracy of the estimates of the CET and CEI neighborhoods for an instance.
+ * 
+ * @tparam Problem type of the problem.
+ * @param os stream where the results will be printed.
+ * @param configuration configuration of the benchmark.
+ * @param instance path of the instance.
+ */
+template <typename Problem> static void RunInstance(std::ostream& os, const Configuration& configuration, const std::string& instance)
+{
+    using TaskType = typename Problem::TaskType;
+    using JobType = typename Problem::JobType;
+    using CETEstimate = CET<Problem, JSPMove, std::true_type>;
+    using CEIEstimate = CEI<Problem, JSPMove, std::true_type>;
+
+    const auto problem = JSPBinaryInstance::IsBinaryInstance(instance) ? read_binary<TaskType, JobType, JSPMachine>(instance)
+                         : configuration.objective == "twt"                ? read_standard_due_dates_file<TaskType, JobType, JSPMachine>(instance)
+                                                                           : read_standard_file<TaskType, JobType, JSPMachine>(instance);
+    if (configuration.objective == "twt") {
+        using Solution = JSPTotalWeightedTardinessMinimizationSolution<Problem, std::true_type>;
+        RunNeighborhood<Solution, CETEstimate>(os, configuration, "CET", instance, problem);
+        RunNeighborhood<Solution, CEIEstimate>(os, configuration, "CEI", instance, problem);
+    } else {
+        using Solution = JSPMakespanMinimizationSolution<Problem, std::true_type>;
+        RunNeighborhood<Solution, CETEstimate>(os, configuration, "CET", instance, problem);
+        RunNeighborhood<Solution, CEIEstimate>(os, configuration, "CEI", instance, problem);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-estimate-bench [-o makespan|twt] [-i iterations] [-n samples] [-seed seed] [instances...]
+    // The errors are relative to the objective of the current solution of the search, positive when the estimate is higher
+    // than the exact objective. us_per_iteration is the time of an iteration of the search without the sampling, and
+    // us_per_exact_evaluation the time of an exact evaluation, what each neighbor would cost without estimates.
+    Configuration configuration;
+    std::vector<std::string> instances;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg.size() > 1 && arg[0] == '-' && i + 1 < argc) {
+            std::string value(argv[++i]);
+            if (arg == "-o") {
+                configuration.objective = value;
+            } else if (arg == "-i") {
+                configuration.iterations = std::stoul(value);
+            } else if (arg == "-n") {
+                configuration.samples = std::stoul(value);
+            } else if (arg == "-seed") {
+                configuration.seed = std::stoull(value);
+            } else {
+                throw std::invalid_argument("unknown option " + arg);
+            }
+        } else {
+            instances.push_back(arg);
+        }
+    }
+    if (configuration.objective != "makespan" && configuration.objective != "twt") {
+        throw std::invalid_argument("unknown objective " + configuration.objective);
+    }
+    if (instances.empty()) {
+        instances = configuration.objective == "twt" ? default_twt_instances : default_makespan_instances;
+    }
+
+    std::cout << "objective,neighborhood,instance,iterations,neighbors_per_iteration,samples,us_per_iteration,us_per_exact_evaluation,"
+                 "exact,underestimated,mean_abs_error,error_p05,error_p50,error_p95,rank_correlation,misranked_pairs,top_agreement"
+              << std::endl;
+    for (const auto& instance: instances) {
+        if (IsFuzzyInstance(instance)) {
+            RunInstance<FuzzyProblemType>(std::cout, configuration, instance);
+        } else {
+            RunInstance<CrispProblemType>(std::cout, configuration, instance);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <benchmarks/benchmark_utils.hpp>
+#include <metaheuristics/evolutionary_algorithm/crossover_operators.hpp>
+#include <metaheuristics/utils/move_data.hpp>
+#include <metaheuristics/utils/tabu_list.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_genetic_encoders.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_move.hpp>
+#include <problems/jsp/jsp_neighborhoods.hpp>
+#include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_restriction_list.hpp>
+#include <utils/allocation_counter.hpp>
+#include <utils/count_allocations.hpp>
+#include <utils/monotonic_arena.hpp>
+#include <utils/philox.hpp>
+
+using Clock = std::chrono::steady_clock;
+
+// instances measured when none is given in the command line
+static const std::vector<std::string> default_instances = {"instances/jsp/standard_format/ft/ft06.txt",
+                                                           "instances/jsp/standard_format/ft/ft10.txt",
+                                                           "instances/jsp/standard_format/la/la21.txt",
+                                                           "instances/jsp/standard_format/ta/ta21.txt",
+                                                           "instances/fjsp/ft06.txt",
+                                                           "instances/fjsp/ft10.txt",
+                                                           "instances/fjsp/la21.txt",
+                                                           "instances/fjsp/ta21.txt"};
+
+/**
+ * @brief Runs an operation repeatedly, doubling the number of repetitions until they last at least the given time,
+ * and prints a line with the nanoseconds and allocations per operation.
+ * 
+ * @tparam Operation type of the operation.
+ * @param os stream where the result will be printed.
+ * @param benchmark name of the benchmark.
+ * @param instance path of the instance.
+ * @param min_time minimum time of the measured repetitions.
+ * @param operation operation to be measured.
+ */
+template <typename Operation>
+static void Measure(std::ostream& os, const std::string& benchmark, const std::string& instance, Clock::duration min_time, Operation&& operation)
+{
+    operation(); // warm up
+    unsigned long long repetitions = 1;
+    while (true) {
+        auto allocations = AllocationCounter::Get();
+        auto start = Clock::now();
+        for (unsigned long long i = 0; i < repetitions; i++) {
+            operation();
+        }
+        auto elapsed = Clock::now() - start;
+        allocations = AllocationCounter::Get() - allocations;
+        if (elapsed >= min_time || repetitions >= (1ULL << 32)) {
+            os << benchmark << ',' << instance << ',' << repetitions << ','
+               << std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(elapsed).count() / repetitions << ','
+               << static_cast<double>(allocations) / repetitions << std::endl;
+            return;
+        }
+        repetitions *= 2;
+    }
+}
+
+/**
+ * @brief Runs all the microbenchmarks over an instance.
+ * 
+ * @tparam Problem type of the problem.
+ * @param os stream where the results will be printed.
+ * @param instance path of the instance.
+ * @param min_time minimum time of each benchmark.
+ */
+template <typename Problem> static void RunBenchmarks(std::ostream& os, const std::string& instance, Clock::duration min_time)
+{
+    using JobType = typename Problem::JobType;
+    using TaskType = typename Problem::TaskType;
+    using SolutionType = JSPMakespanMinimizationSolution<Problem, std::true_type>;
+    using MoveType = JSPMove<Problem>;
+    using MoveDataType = MoveData<MoveType, typename SolutionType::ObjectiveType>;
+    using BlockType = JSPRestrictionList<Problem>;
+    using EncoderDecoder = PermutationWithRepetition<GT>;
+
+    const bool binary = JSPBinaryInstance::IsBinaryInstance(instance);
+    const auto problem = binary ? read_binary<TaskType, JobType, JSPMachine>(instance) : read_standard_file<TaskType, JobType, JSPMachine>(instance);
+    Philox4x32 rng(0);
+
+    if (binary) {
+        Measure(os, "ReadBinary", instance, min_time, [&]() { DoNotOptimize(read_binary<TaskType, JobType, JSPMachine>(instance)); });
+    } else {
+        Measure(os, "ReadStandardStream", instance, min_time, [&]() {
+            std::ifstream is(instance);
+            DoNotOptimize(read_standard<TaskType, JobType, JSPMachine>(is));
+        });
+        Measure(os, "ReadStandardFile", instance, min_time, [&]() { DoNotOptimize(read_standard_file<TaskType, JobType, JSPMachine>(instance)); });
+    }
+
+    // random chromosomes
+    std::vector<unsigned int> chromosome1;
+    std::vector<std::reference_wrapper<const JobType>> jobs;
+    problem.GetJobs(std::back_inserter(jobs));
+    for (const JobType& job: jobs) {
+        std::fill_n(std::back_inserter(chromosome1), problem.GetNumberOfTasksInJob(job.GetJobID()), job.GetJobID());
+    }
+    auto chromosome2 = chromosome1;
+    std::shuffle(chromosome1.begin(), chromosome1.end(), rng);
+    std::shuffle(chromosome2.begin(), chromosome2.end(), rng);
+    const auto solution = EncoderDecoder::DecodeSolution<SolutionType>(chromosome1.begin(), chromosome1.end(), problem);
+    DoNotOptimize(solution.GetQuality()); // heads and tails up to date
+
+    Measure(os, "GTDecode", instance, min_time, [&]() {
+        DoNotOptimize(EncoderDecoder::DecodeSolution<SolutionType>(chromosome2.begin(), chromosome2.end(), problem));
+    });
+    Measure(os, "EvaluateSolutionQuality", instance, min_time, [&]() {
+        DoNotOptimize(EncoderDecoder::EvaluateSolutionQuality<SolutionType>(chromosome2.begin(), chromosome2.end(), problem));
+    });
+    Measure(os, "GOXCross", instance, min_time, [&]() {
+        std::vector<unsigned int> offspring1;
+        std::vector<unsigned int> offspring2;
+        GOX::Cross(chromosome1.begin(),
+                   chromosome1.end(),
+                   chromosome2.begin(),
+                   chromosome2.end(),
+                   std::back_inserter(offspring1),
+                   std::back_inserter(offspring2),
+                   rng);
+        DoNotOptimize(offspring1);
+        DoNotOptimize(offspring2);
+    });
+    Measure(os, "SolutionCopy", instance, min_time, [&]() {
+        SolutionType copy(solution);
+        DoNotOptimize(copy);
+    });
+
+    std::vector<MoveDataType> moves;
+    CET<Problem>::GetNeighbors(std::back_inserter(moves), solution);
+    if (!moves.empty()) {
+        SolutionType copy(solution);
+        const MoveType move = moves.front().move;
+        MoveType inverse = move;
+        inverse.Invert();
+        bool inverted = false;
+        Measure(os, "UpdateHeadsAndTailsAfterSwap", instance, min_time, [&]() {
+            copy.ApplyMove(inverted ? inverse : move);
+            inverted = !inverted;
+            DoNotOptimize(copy.GetQuality());
+        });
+    }
+
+    Measure(os, "GetCriticalBlocks", instance, min_time, [&]() {
+        std::vector<BlockType> blocks;
+        solution.template GetCriticalBlocks<BlockType>(std::back_inserter(blocks));
+        DoNotOptimize(blocks);
+    });
+    Measure(os, "CET", instance, min_time, [&]() {
+        std::vector<MoveDataType> neighbors;
+        CET<Problem>::GetNeighbors(std::back_inserter(neighbors), solution);
+        DoNotOptimize(neighbors);
+    });
+    Measure(os, "CETEstimate", instance, min_time, [&]() {
+        std::vector<MoveDataType> neighbors;
+        CET<Problem, JSPMove, std::true_type>::GetNeighbors(std::back_inserter(neighbors), solution);
+        DoNotOptimize(neighbors);
+    });
+    Measure(os, "CEI", instance, min_time, [&]() {
+        std::vector<MoveDataType> neighbors;
+        CEI<Problem>::GetNeighbors(std::back_inserter(neighbors), solution);
+        DoNotOptimize(neighbors);
+    });
+    Measure(os, "CEIEstimate", instance, min_time, [&]() {
+        std::vector<MoveDataType> neighbors;
+        CEI<Problem, JSPMove, std::true_type>::GetNeighbors(std::back_inserter(neighbors), solution);
+        DoNotOptimize(neighbors);
+    });
+    // the same neighborhoods as in the tabu search, with the containers in an arena that is reset before each operation
+    MonotonicArena arena;
+    Measure(os, "CETEstimateArena", instance, min_time, [&]() {
+        arena.Reset();
+        std::pmr::vector<MoveDataType> neighbors(&arena);
+        CET<Problem, JSPMove, std::true_type>::GetNeighbors(std::back_inserter(neighbors), solution, &arena);
+        DoNotOptimize(neighbors);
+    });
+    Measure(os, "CEIEstimateArena", instance, min_time, [&]() {
+        arena.Reset();
+        std::pmr::vector<MoveDataType> neighbors(&arena);
+        CEI<Problem, JSPMove, std::true_type>::GetNeighbors(std::back_inserter(neighbors), solution, &arena);
+        DoNotOptimize(neighbors);
+    });
+
+    // tabu list with the size used by the memetic algorithm, filled with the CEI moves
+    std::vector<MoveDataType> neighbors;
+    CEI<Problem>::GetNeighbors(std::back_inserter(neighbors), solution);
+    if (!neighbors.empty()) {
+        TabuList<MoveType> tabu_list(problem.GetNumberOfJobs() + problem.GetNumberOfMachines());
+        for (std::size_t i = 0; i < tabu_list.Capacity(); i++) {
+            tabu_list.ForcePush(neighbors[i % neighbors.size()].move);
+        }
+        std::size_t next = 0;
+        Measure(os, "TabuListContains", instance, min_time, [&]() {
+            DoNotOptimize(tabu_list.Contains(neighbors[next].move));
+            next = next + 1 == neighbors.size() ? 0 : next + 1;
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-bench [-t milliseconds] [instances...]
+    Clock::duration min_time = std::chrono::milliseconds(200);
+    std::vector<std::string> instances;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "-t" && i + 1 < argc) {
+            min_time = std::chrono::milliseconds(std::stoul(argv[++i]));
+        } else {
+            instances.push_back(argv[i]);
+        }
+    }
+    if (instances.empty()) {
+        instances = default_instances;
+    }
+
+    std::cout << "benchmark,instance,repetitions,ns_per_op,allocs_per_op" << std::endl;
+    for (const auto& instance: instances) {
+        if (IsFuzzyInstance(instance)) {
+            RunBenchmarks<FuzzyProblemType>(std::cout, instance, min_time);
+        } else {
+            RunBenchmarks<CrispProblemType>(std::cout, instance, min_time);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,223 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmarks/benchmark_utils.hpp>
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_solvers.hpp>
+#include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <utils/philox.hpp>
+
+/**
+ * @brief Result of a replica.
+ * 
+ */
+struct Run
+{
+    unsigned int stream; // stream of the random number generator
+    double best; // objective value of the best solution found
+    double time; // wall-clock time in milliseconds
+    unsigned long long evaluations; // evaluations consumed
+    bool optimal; // true if the solver proved that its best solution is optimal
+    std::optional<double> time_to_target; // milliseconds until a solution reached the target
+    std::vector<std::pair<double, double>> curve; // milliseconds and objective value of each improvement
+};
+
+/**
+ * @brief Configuration of the benchmark.
+ * 
+ */
+struct Configuration
+{
+    std::string solver_name = "memetic"; // name of the solver
+    std::string objective = "makespan"; // objective to be minimized, makespan or twt
+    unsigned int replicas = 5; // replicas per instance
+    unsigned long long seed = 1; // seed of the random number generator, each replica uses its own stream
+    long time_limit = 10000; // wall-clock time per replica in milliseconds
+    unsigned long long evaluation_limit = std::numeric_limits<unsigned long long>::max(); // evaluations per replica
+};
+
+/**
+ * @brief Runs the replicas of an instance.
+ * 
+ * @tparam Problem type of the problem.
+ * @tparam Solution type of the solution.
+ * @param configuration configuration of the benchmark.
+ * @param path path of the instance.
+ * @param target objective value whose time to reach is measured.
+ * @param lower_bound where the lower bound of the objective of the instance is stored.
+ * @return the results of the replicas.
+ */
+template <typename Problem, typename Solution>
+static std::vector<Run> RunInstance(const Configuration& configuration, const std::string& path, std::optional<double> target, double& lower_bound)
+{
+    using TaskType = typename Problem::TaskType;
+    using JobType = typename Problem::JobType;
+
+    const auto problem = JSPBinaryInstance::IsBinaryInstance(path) ? read_binary<TaskType, JobType, JSPMachine>(path)
+                         : configuration.objective == "twt"            ? read_standard_due_dates_file<TaskType, JobType, JSPMachine>(path)
+                                                                       : read_standard_file<TaskType, JobType, JSPMachine>(path);
+    const auto solver = ParseJSPSolverType(configuration.solver_name);
+    lower_bound = JSPSolvers::LowerBound<Solution>(problem);
+
+    std::vector<Run> runs;
+    for (unsigned int replica = 0; replica < configuration.replicas; replica++) {
+        Run run{};
+        run.stream = replica;
+        Philox4x32 rng(configuration.seed, replica);
+        SearchBudget budget(std::chrono::milliseconds(configuration.time_limit), configuration.evaluation_limit);
+        const auto record = [&run, &budget, &target](const Solution& solution) {
+            double time = std::chrono::duration<double, std::milli>(budget.Elapsed()).count();
+            double value = JSPSolvers::ObjectiveValue(solution);
+            run.curve.emplace_back(time, value);
+            if (target.has_value() && !run.time_to_target.has_value() && value <= *target) {
+                run.time_to_target = time;
+            }
+        };
+        auto best = JSPSolvers::Solve<Solution>(solver, budget, record, problem, rng);
+        run.time = std::chrono::duration<double, std::milli>(budget.Elapsed()).count();
+        run.best = JSPSolvers::ObjectiveValue(best);
+        run.evaluations = budget.GetEvaluations();
+        run.optimal = budget.Finished();
+        runs.push_back(std::move(run));
+    }
+    return runs;
+}
+
+/**
+ * @brief Prints the results of an instance as a JSON object.
+ * 
+ * @param os stream where the results will be printed.
+ * @param path path of the instance.
+ * @param target objective value whose time to reach is measured.
+ * @param lower_bound lower bound of the objective of the instance.
+ * @param runs results of the replicas.
+ */
+static void PrintInstance(std::ostream& os, const std::string& path, std::optional<double> target, double lower_bound, const std::vector<Run>& runs)
+{
+    double best = std::numeric_limits<double>::infinity();
+    double sum = 0;
+    double evaluations_per_second = 0;
+    double time_to_target = 0;
+    unsigned int successes = 0;
+    for (const auto& run: runs) {
+        best = std::min(best, run.best);
+        sum += run.best;
+        evaluations_per_second += run.time > 0 ? run.evaluations / (run.time / 1000) : 0;
+        if (run.time_to_target.has_value()) {
+            time_to_target += *run.time_to_target;
+            successes++;
+        }
+    }
+    os << "    {\"instance\": \"" << path << "\", ";
+    if (target.has_value()) {
+        os << "\"target\": " << *target << ", ";
+    }
+    os << "\"lower_bound\": " << lower_bound << ", \"best\": " << best << ", \"gap\": " << JSPSolvers::Gap(best, lower_bound)
+       << ", \"mean\": " << sum / runs.size() << ", \"evaluations_per_second\": " << evaluations_per_second / runs.size();
+    if (target.has_value()) {
+        os << ", \"successes\": " << successes << ", \"mean_time_to_target_ms\": ";
+        if (successes > 0) {
+            os << time_to_target / successes;
+        } else {
+            os << "null";
+        }
+    }
+    os << ",\n     \"runs\": [";
+    for (std::size_t i = 0; i < runs.size(); i++) {
+        const auto& run = runs[i];
+        os << (i == 0 ? "\n" : ",\n") << "        {\"stream\": " << run.stream << ", \"best\": " << run.best
+           << ", \"gap\": " << JSPSolvers::Gap(run.best, lower_bound) << ", \"optimal\": " << (run.optimal ? "true" : "false")
+           << ", \"time_ms\": " << run.time
+           << ", \"evaluations\": " << run.evaluations << ", \"time_to_target_ms\": ";
+        if (run.time_to_target.has_value()) {
+            os << *run.time_to_target;
+        } else {
+            os << "null";
+        }
+        os << ", \"curve\": [";
+        for (std::size_t j = 0; j < run.curve.size(); j++) {
+            os << (j == 0 ? "" : ", ") << '[' << run.curve[j].first << ", " << run.curve[j].second << ']';
+        }
+        os << "]}";
+    }
+    os << "]}";
+}
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-solver-bench [-s memetic|memetic-pr|memetic-ss|memetic-adaptive|ea|tabu|exact|auto] [-o makespan|twt] [-r replicas]
+    //                             [-seed seed] [-t milliseconds] [-e evaluations] instance[:target]...
+    Configuration configuration;
+    std::vector<std::pair<std::string, std::optional<double>>> instances;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg.size() > 1 && arg[0] == '-' && i + 1 < argc) {
+            std::string value(argv[++i]);
+            if (arg == "-s") {
+                configuration.solver_name = value;
+            } else if (arg == "-o") {
+                configuration.objective = value;
+            } else if (arg == "-r") {
+                configuration.replicas = std::stoul(value);
+            } else if (arg == "-seed") {
+                configuration.seed = std::stoull(value);
+            } else if (arg == "-t") {
+                configuration.time_limit = std::stol(value);
+            } else if (arg == "-e") {
+                configuration.evaluation_limit = std::stoull(value);
+            } else {
+                throw std::invalid_argument("unknown option " + arg);
+            }
+        } else {
+            auto separator = arg.find_last_of(':');
+            if (separator == std::string::npos) {
+                instances.emplace_back(arg, std::nullopt);
+            } else {
+                instances.emplace_back(arg.substr(0, separator), std::stod(arg.substr(separator + 1)));
+            }
+        }
+    }
+    if (instances.empty()) {
+        throw std::invalid_argument("Missing instances");
+    }
+    if (configuration.objective != "makespan" && configuration.objective != "twt") {
+        throw std::invalid_argument("unknown objective " + configuration.objective);
+    }
+    ParseJSPSolverType(configuration.solver_name);
+
+    std::cout << std::setprecision(10);
+    std::cout << "{\"solver\": \"" << configuration.solver_name << "\", \"objective\": \"" << configuration.objective
+              << "\", \"replicas\": " << configuration.replicas << ", \"seed\": " << configuration.seed
+              << ", \"time_limit_ms\": " << configuration.time_limit << ",\n \"instances\": [";
+    for (std::size_t i = 0; i < instances.size(); i++) {
+        const auto& [path, target] = instances[i];
+        std::vector<Run> runs;
+        double lower_bound = 0;
+        bool fuzzy = IsFuzzyInstance(path);
+        if (configuration.objective == "makespan") {
+            runs = fuzzy ? RunInstance<FuzzyProblemType, JSPMakespanMinimizationSolution<FuzzyProblemType>>(configuration, path, target, lower_bound)
+                         : RunInstance<CrispProblemType, JSPMakespanMinimizationSolution<CrispProblemType>>(configuration, path, target, lower_bound);
+        } else {
+            using FuzzySolution = JSPTotalWeightedTardinessMinimizationSolution<FuzzyProblemType>;
+            using CrispSolution = JSPTotalWeightedTardinessMinimizationSolution<CrispProblemType>;
+            runs = fuzzy ? RunInstance<FuzzyProblemType, FuzzySolution>(configuration, path, target, lower_bound)
+                         : RunInstance<CrispProblemType, CrispSolution>(configuration, path, target, lower_bound);
+        }
+        std::cout << (i == 0 ? "\n" : ",\n");
+        PrintInstance(std::cout, path, target, lower_bound, runs);
+        std::cout.flush();
+    }
+    std::cout << "\n]}" << std::endl;
+    return 0;
+}
@@ -0,0 +1,614 @@
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_job.hpp>
+#include <problems/jsp/jsp_machine.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_solvers.hpp>
+#include <problems/jsp/jsp_task.hpp>
+#include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <utils/mapped_file.hpp>
+#include <utils/philox.hpp>
+#include <utils/text_scanner.hpp>
+#include <utils/thread_pool.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+// Protocol: each request is a line of space-separated key=value fields, the first field is the command.
+//
+//   solve id=<id> [objective=twt|makespan] [solver=memetic|memetic-pr|memetic-ss|memetic-adaptive|ea|tabu|exact|auto]
+//         [time_ms=<ms>] [evaluations=<n>] [seed=<n>] [improvements=0|1] (path=<path> | bytes=<n>)
+//     solves an instance, read from a file (text or binary) or from the <n> bytes (text, at most 1 GiB) that follow the line;
+//     the default solver is auto, which solves the small instances exactly; every solver stops at the end of the step (the
+//     decoding or the local search of an individual) in which time_ms is reached or the request is cancelled
+//   cancel id=<id>
+//     cancels a request of the same connection, its result is sent with status=cancelled
+//
+// Each response is a line:
+//
+//   accepted id=<id> cached=0|1
+//   improvement id=<id> time_ms=<ms> value=<value>
+//   result id=<id> status=completed|cancelled value=<value> lower_bound=<bound> gap=<gap> optimal=0|1 time_ms=<ms> evaluations=<n> machines=<m>
+//     followed by <m> lines with the jobs processed in each machine, in order
+//   error id=<id> message=<message>
+//
+// The values are expected values for fuzzy objectives. The value is optimal if the gap is zero or the solver (exact, or auto
+// for small instances) has proven it, the search is finished as soon as it is. Several requests of a connection can run at the same time.
+
+// the durations are fuzzy, crisp instances are read as degenerate fuzzy numbers
+using JobType = JSPJob<double>;
+using MachineType = JSPMachine;
+using TaskType = JSPTask<TriangularFuzzyNumber<double>, JobType, MachineType>;
+using ProblemType = JSP<TaskType, JobType, MachineType>;
+
+static std::atomic<bool> stop_requested{false}; // set by SIGINT and SIGTERM
+
+/**
+ * @brief Returns the 64-bit FNV-1a hash of a sequence of bytes.
+ * 
+ * @param first first byte.
+ * @param last byte past the last byte.
+ * @return the hash of the bytes.
+ */
+static std::uint64_t Fnv1a(const char* first, const char* last)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    for (; first != last; first++) {
+        hash = (hash ^ static_cast<unsigned char>(*first)) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Cache of parsed instances, keyed by the hash and size of their contents and by their format.
+ * When it is full the least recently used instance is evicted; the requests that use it keep it alive.
+ * 
+ */
+class InstanceCache
+{
+  private:
+    using Key = std::tuple<std::uint64_t, std::size_t, bool>; // hash, size and with due dates
+
+    std::mutex mutex; // protects the entries
+    std::size_t capacity; // maximum number of instances
+    std::list<std::pair<Key, std::shared_ptr<const ProblemType>>> entries; // instances from the most to the least recently used
+    std::map<Key, decltype(entries)::iterator> index; // position of each instance in the list
+
+  public:
+    /**
+     * @brief Constructs a new InstanceCache.
+     * 
+     * @param capacity maximum number of instances.
+     */
+    explicit InstanceCache(std::size_t capacity) : capacity{capacity == 0 ? 1 : capacity} {}
+
+    /**
+     * @brief Returns the instance with the given contents, parsing it if it is not in the cache.
+     * 
+     * @tparam Parser type of the function that parses the contents.
+     * @param first first byte of the contents.
+     * @param last byte past the last byte of the contents.
+     * @param due_dates true if the jobs have due dates and weights, false in other case.
+     * @param parse function that parses the contents, only called on a miss.
+     * @param cached where it is stored if the instance was in the cache.
+     * @return the instance.
+     */
+    template <typename Parser>
+    std::shared_ptr<const ProblemType> Get(const char* first, const char* last, bool due_dates, const Parser& parse, bool& cached)
+    {
+        Key key{Fnv1a(first, last), static_cast<std::size_t>(last - first), due_dates};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = index.find(key);
+            if (found != index.end()) {
+                entries.splice(entries.begin(), entries, found->second);
+                cached = true;
+                return found->second->second;
+            }
+        }
+        cached = false;
+        auto problem = std::make_shared<const ProblemType>(parse()); // parsed outside the lock
+        std::lock_guard<std::mutex> lock(mutex);
+        if (index.count(key) == 0) {
+            entries.emplace_front(key, problem);
+            index[key] = entries.begin();
+            if (entries.size() > capacity) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+            }
+        }
+        return problem;
+    }
+};
+
+/**
+ * @brief Connection with a client. The responses of the requests that run at the same time are serialized line by line.
+ * The socket is closed when the connection and all its requests have finished.
+ * 
+ */
+class Connection
+{
+  private:
+    int socket; // socket of the connection
+    std::mutex output; // serializes the responses
+    std::mutex mutex; // protects the active requests
+    std::unordered_map<std::string, std::shared_ptr<std::atomic<bool>>> active; // cancellation flags of the running requests
+
+  public:
+    /**
+     * @brief Constructs a new Connection.
+     * 
+     * @param socket socket of the connection.
+     */
+    explicit Connection(int socket) : socket{socket} {}
+
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    ~Connection()
+    {
+        close(socket);
+    }
+
+    int GetSocket() const
+    {
+        return socket;
+    }
+
+    /**
+     * @brief Sends a response. Errors are ignored, the client may have gone away.
+     * 
+     * @param response response, including the final new line.
+     */
+    void Send(const std::string& response)
+    {
+        std::lock_guard<std::mutex> lock(output);
+        std::size_t sent = 0;
+        while (sent < response.size()) {
+            ssize_t n = send(socket, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return;
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+    }
+
+    /**
+     * @brief Registers a request.
+     * 
+     * @param id identifier of the request.
+     * @return the cancellation flag of the request, nullptr if there is another active request with the same identifier.
+     */
+    std::shared_ptr<std::atomic<bool>> Register(const std::string& id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto flag = std::make_shared<std::atomic<bool>>(false);
+        return active.emplace(id, flag).second ? flag : nullptr;
+    }
+
+    /**
+     * @brief Unregisters a finished request.
+     * 
+     * @param id identifier of the request.
+     */
+    void Unregister(const std::string& id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        active.erase(id);
+    }
+
+    /**
+     * @brief Cancels a request.
+     * 
+     * @param id identifier of the request.
+     * @return true if the request was active, false in other case.
+     */
+    bool Cancel(const std::string& id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = active.find(id);
+        if (found == active.end()) {
+            return false;
+        }
+        found->second->store(true);
+        return true;
+    }
+
+    /**
+     * @brief Cancels all the requests.
+     * 
+     */
+    void CancelAll()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& request: active) {
+            request.second->store(true);
+        }
+    }
+};
+
+/**
+ * @brief Parameters of a solve request.
+ * 
+ */
+struct SolveRequest
+{
+    std::string id; // identifier of the request, chosen by the client
+    std::string objective = "twt"; // objective to be minimized, makespan or twt
+    std::string solver_name = "auto"; // name of the solver
+    long time_limit = 0; // wall-clock time in milliseconds, 0 for no limit
+    unsigned long long evaluation_limit = std::numeric_limits<unsigned long long>::max(); // maximum number of evaluations
+    std::uint64_t seed = 0; // seed of the random number generator
+    bool improvements = true; // true to stream the improvements
+};
+
+/**
+ * @brief Solves a request and sends its improvements and its result.
+ * 
+ * @tparam Solution type of the solution.
+ * @param connection connection of the request.
+ * @param request parameters of the request.
+ * @param problem problem to be solved.
+ * @param cancellation cancellation flag of the request.
+ */
+template <typename Solution>
+static void Solve(Connection& connection, const SolveRequest& request, const ProblemType& problem, const std::atomic<bool>& cancellation)
+{
+    SearchBudget budget(request.time_limit > 0 ? std::chrono::milliseconds(request.time_limit) : SearchBudget::Clock::duration::max(),
+                        request.evaluation_limit);
+    budget.SetCancellationFlag(&cancellation);
+    const auto publish = [&connection, &request, &budget](const Solution& solution) {
+        if (request.improvements) {
+            std::ostringstream os;
+            os << "improvement id=" << request.id << " time_ms=" << std::chrono::duration<double, std::milli>(budget.Elapsed()).count()
+               << " value=" << JSPSolvers::ObjectiveValue(solution) << '\n';
+            connection.Send(os.str());
+        }
+    };
+    Philox4x32 rng(request.seed);
+    auto best = JSPSolvers::Solve<Solution>(ParseJSPSolverType(request.solver_name), budget, publish, problem, rng);
+    double value = JSPSolvers::ObjectiveValue(best);
+    double lower_bound = JSPSolvers::LowerBound<Solution>(problem);
+
+    std::ostringstream os;
+    os << "result id=" << request.id << " status=" << (budget.Cancelled() ? "cancelled" : "completed") << " value=" << value
+       << " lower_bound=" << lower_bound << " gap=" << JSPSolvers::Gap(value, lower_bound) << " optimal=" << budget.Finished()
+       << " time_ms=" << std::chrono::duration<double, std::milli>(budget.Elapsed()).count()
+       << " evaluations=" << budget.GetEvaluations() << " machines=" << problem.GetNumberOfMachines() << '\n'
+       << best.SolutionSequence();
+    connection.Send(os.str());
+}
+
+/**
+ * @brief Daemon that serves the requests of the connections on a shared pool of threads.
+ * 
+ */
+class Daemon
+{
+  private:
+    static constexpr std::size_t max_payload_bytes = std::size_t{1} << 30; // maximum size of an instance sent inline
+
+    InstanceCache cache; // parsed instances
+    ThreadPool pool; // runs the solve requests
+
+    /**
+     * @brief Parses the fields of a request line.
+     * 
+     * @param line request line, without the command.
+     * @return the value of each key.
+     */
+    static std::map<std::string, std::string> ParseFields(std::istringstream& line)
+    {
+        std::map<std::string, std::string> fields;
+        std::string field;
+        while (line >> field) {
+            auto separator = field.find('=');
+            if (separator == std::string::npos) {
+                throw std::invalid_argument("malformed field " + field);
+            }
+            fields[field.substr(0, separator)] = field.substr(separator + 1);
+        }
+        return fields;
+    }
+
+    /**
+     * @brief Parses the size of the payload of a request.
+     * 
+     * @param value value of the bytes field.
+     * @return the size of the payload.
+     * @throws std::invalid_argument if the value is not a number of bytes up to the maximum size of a payload.
+     */
+    static std::size_t ParseBytes(const std::string& value)
+    {
+        if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+            throw std::invalid_argument("invalid bytes " + value);
+        }
+        try {
+            unsigned long long bytes = std::stoull(value);
+            if (bytes <= max_payload_bytes) {
+                return static_cast<std::size_t>(bytes);
+            }
+        } catch (const std::out_of_range&) {
+        }
+        throw std::invalid_argument("bytes larger than " + std::to_string(max_payload_bytes));
+    }
+
+    /**
+     * @brief Starts a solve request.
+     * 
+     * @param connection connection of the request.
+     * @param fields fields of the request.
+     * @param payload contents of the instance, empty if it is read from a path.
+     */
+    void StartSolve(const std::shared_ptr<Connection>& connection, const std::map<std::string, std::string>& fields, const std::string& payload)
+    {
+        SolveRequest request;
+        request.id = fields.count("id") ? fields.at("id") : "";
+        try {
+            for (const auto& [key, value]: fields) {
+                if (key == "objective") {
+                    request.objective = value;
+                } else if (key == "solver") {
+                    request.solver_name = value;
+                } else if (key == "time_ms") {
+                    request.time_limit = std::stol(value);
+                } else if (key == "evaluations") {
+                    request.evaluation_limit = std::stoull(value);
+                } else if (key == "seed") {
+                    request.seed = std::stoull(value);
+                } else if (key == "improvements") {
+                    request.improvements = value != "0";
+                } else if (key != "id" && key != "path" && key != "bytes") {
+                    throw std::invalid_argument("unknown field " + key);
+                }
+            }
+            if (request.id.empty()) {
+                throw std::invalid_argument("missing id");
+            }
+            if (request.objective != "makespan" && request.objective != "twt") {
+                throw std::invalid_argument("unknown objective " + request.objective);
+            }
+            ParseJSPSolverType(request.solver_name);
+
+            bool due_dates = request.objective == "twt";
+            bool cached = false;
+            std::shared_ptr<const ProblemType> problem;
+            if (fields.count("path")) {
+                const std::string& path = fields.at("path");
+                MappedFile file(path);
+                bool binary = JSPBinaryInstance::IsBinaryInstance(path);
+                problem = cache.Get(file.begin(), file.end(), due_dates && !binary, [&]() {
+                    if (binary) {
+                        return read_binary<TaskType, JobType, MachineType>(path);
+                    }
+                    TextScanner scanner(file.begin(), file.end());
+                    return read_standard_buffer<TaskType, JobType, MachineType>(scanner, due_dates);
+                }, cached);
+            } else if (fields.count("bytes")) {
+                problem = cache.Get(payload.data(), payload.data() + payload.size(), due_dates, [&]() {
+                    TextScanner scanner(payload.data(), payload.data() + payload.size());
+                    return read_standard_buffer<TaskType, JobType, MachineType>(scanner, due_dates);
+                }, cached);
+            } else {
+                throw std::invalid_argument("missing path or bytes");
+            }
+
+            auto cancellation = connection->Register(request.id);
+            if (cancellation == nullptr) {
+                throw std::invalid_argument("duplicated id");
+            }
+            connection->Send("accepted id=" + request.id + " cached=" + (cached ? "1" : "0") + "\n");
+            pool.Submit([connection, request, problem, cancellation]() {
+                try {
+                    if (request.objective == "twt") {
+                        Solve<JSPTotalWeightedTardinessMinimizationSolution<ProblemType>>(*connection, request, *problem, *cancellation);
+                    } else {
+                        Solve<JSPMakespanMinimizationSolution<ProblemType>>(*connection, request, *problem, *cancellation);
+                    }
+                } catch (const std::exception& e) {
+                    connection->Send("error id=" + request.id + " message=" + e.what() + "\n");
+                }
+                connection->Unregister(request.id);
+            });
+        } catch (const std::exception& e) {
+            connection->Send("error id=" + request.id + " message=" + e.what() + "\n");
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs a new Daemon.
+     * 
+     * @param threads number of threads that run the requests, 0 to use one per hardware thread.
+     * @param cache_capacity maximum number of parsed instances kept in the cache.
+     */
+    Daemon(std::size_t threads, std::size_t cache_capacity) : cache{cache_capacity}, pool{threads} {}
+
+    /**
+     * @brief Serves the requests of a connection until the client closes it. Its running requests are then cancelled.
+     * 
+     * @param connection connection to be served.
+     */
+    void Serve(const std::shared_ptr<Connection>& connection)
+    {
+        std::string buffer;
+        std::size_t pending_bytes = 0; // bytes of the payload that are still to be received
+        std::map<std::string, std::string> pending_fields; // fields of the request whose payload is being received
+        char chunk[65536];
+        while (true) {
+            ssize_t n = recv(connection->GetSocket(), chunk, sizeof(chunk), 0);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                break;
+            }
+            buffer.append(chunk, static_cast<std::size_t>(n));
+            while (true) {
+                if (pending_bytes > 0) {
+                    if (buffer.size() < pending_bytes) {
+                        break;
+                    }
+                    std::string payload = buffer.substr(0, pending_bytes);
+                    buffer.erase(0, pending_bytes);
+                    pending_bytes = 0;
+                    StartSolve(connection, pending_fields, payload);
+                    continue;
+                }
+                auto end = buffer.find('\n');
+                if (end == std::string::npos) {
+                    break;
+                }
+                std::istringstream line(buffer.substr(0, end));
+                buffer.erase(0, end + 1);
+                std::string command;
+                if (!(line >> command)) {
+                    continue;
+                }
+                std::map<std::string, std::string> fields;
+                try {
+                    fields = ParseFields(line);
+                } catch (const std::exception& e) {
+                    connection->Send(std::string("error id= message=") + e.what() + "\n");
+                    continue;
+                }
+                const std::string id = fields.count("id") ? fields.at("id") : "";
+                if (command == "solve" && fields.count("bytes")) {
+                    try {
+                        pending_bytes = ParseBytes(fields.at("bytes"));
+                    } catch (const std::exception& e) {
+                        connection->Send("error id=" + id + " message=" + e.what() + "\n");
+                        continue;
+                    }
+                    pending_fields = fields;
+                    if (pending_bytes == 0) {
+                        StartSolve(connection, pending_fields, "");
+                    }
+                } else if (command == "solve") {
+                    StartSolve(connection, fields, "");
+                } else if (command == "cancel") {
+                    if (!connection->Cancel(id)) {
+                        connection->Send("error id=" + id + " message=unknown request\n");
+                    }
+                } else {
+                    connection->Send("error id=" + id + " message=unknown command " + command + "\n");
+                }
+            }
+        }
+        connection->CancelAll();
+    }
+};
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-daemon [-j threads] [-c cache_capacity] socket
+    std::size_t threads = 0;
+    std::size_t cache_capacity = 64;
+    std::string socket_path;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg == "-j" && i + 1 < argc) {
+            threads = std::stoul(argv[++i]);
+        } else if (arg == "-c" && i + 1 < argc) {
+            cache_capacity = std::stoul(argv[++i]);
+        } else {
+            socket_path = arg;
+        }
+    }
+    if (socket_path.empty()) {
+        throw std::invalid_argument("Missing socket");
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("socket path too long");
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socket_path.c_str());
+    if (listener < 0 || bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(listener, 64) < 0) {
+        throw std::runtime_error("cannot listen on " + socket_path + ": " + std::strerror(errno));
+    }
+    std::signal(SIGINT, [](int) { stop_requested = true; });
+    std::signal(SIGTERM, [](int) { stop_requested = true; });
+
+    // thread that serves a connection
+    struct Server
+    {
+        std::weak_ptr<Connection> connection; // connection served, alive while the server or its requests run
+        std::shared_ptr<std::atomic<bool>> done; // set when the client has closed the connection
+        std::thread thread; // thread of the server
+    };
+
+    std::list<Server> servers;
+    {
+        Daemon daemon(threads, cache_capacity);
+        while (!stop_requested) {
+            // the threads of the closed connections are joined
+            for (auto server = servers.begin(); server != servers.end();) {
+                if (*server->done) {
+                    server->thread.join();
+                    server = servers.erase(server);
+                } else {
+                    ++server;
+                }
+            }
+            pollfd descriptor{listener, POLLIN, 0};
+            if (poll(&descriptor, 1, 200) <= 0) {
+                continue;
+            }
+            int client = accept(listener, nullptr, nullptr);
+            if (client < 0) {
+                continue;
+            }
+            auto connection = std::make_shared<Connection>(client);
+            auto done = std::make_shared<std::atomic<bool>>(false);
+            servers.push_back(Server{connection, done, std::thread([&daemon, connection, done]() {
+                                         daemon.Serve(connection);
+                                         *done = true;
+                                     })});
+        }
+        // the connections are shut down, so their requests are cancelled and the servers and the pool finish
+        for (auto& server: servers) {
+            if (auto connection = server.connection.lock()) {
+                shutdown(connection->GetSocket(), SHUT_RDWR);
+            }
+        }
+        for (auto& server: servers) {
+            server.thread.join();
+        }
+    }
+    close(listener);
+    unlink(socket_path.c_str());
+    return 0;
+}
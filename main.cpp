@@ -1,11 +1,16 @@
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <random>
+#include <string>
+#include <vector>
 
 #include <metaheuristics/evolutionary_algorithm/crossover_operators.hpp>
 #include <metaheuristics/evolutionary_algorithm/evolutionary_algorithm.hpp>
@@ -15,74 +20,29 @@
 #include <metaheuristics/evolutionary_algorithm/selection_operators.hpp>
 #include <metaheuristics/tabu_search/tabu_search_fixed_length.hpp>
 #include <metaheuristics/tabu_search/tabu_search_variable_length.hpp>
+#include <metaheuristics/utils/checkpoint.hpp>
 #include <metaheuristics/utils/evolutionary_algorithm_logger.hpp>
 #include <metaheuristics/utils/local_search_logger.hpp>
+#include <metaheuristics/utils/search_budget.hpp>
+#include <metaheuristics/utils/trace_loggers.hpp>
+#include <metaheuristics/utils/trace_writer.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
 #include <problems/jsp/jsp_generation_operators.hpp>
 #include <problems/jsp/jsp_job.hpp>
+#include <problems/jsp/jsp_lower_bounds.hpp>
 #include <problems/jsp/jsp_machine.hpp>
 #include <problems/jsp/jsp_makespan_minimization_solution.hpp>
 #include <problems/jsp/jsp_neighborhoods.hpp>
 #include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_solvers.hpp>
 #include <problems/jsp/jsp_task.hpp>
 #include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <problems/jsp/jsp_warm_start.hpp>
+#include <utils/philox.hpp>
 
-template <typename RealNumber> static bool AlmostEqual(RealNumber a, RealNumber b, RealNumber tolerance = std::numeric_limits<RealNumber>::epsilon())
-{
-    RealNumber d = std::fabs(a - b);
-    if (d <= tolerance) {
-        return true;
-    }
-    if (d < std::fmax(std::fabs(a), std::fabs(b)) * tolerance) {
-        return true;
-    }
-    return false;
-}
-
-template <typename Problem, typename Solution>
-std::tuple<Solution, EvolutionaryAlgorithmLogger<Solution>, LocalSearchLogger<Solution>> MemeticAlgorithm(Problem& problem)
-{
-    std::random_device rd{};
-    std::mt19937 rng(rd());
-    JSPRandomPopulationGenerator generation_operator{};
-    GOX crossover_op{};
-    PairSelection selection_op{};
-    Swap mutation_op{};
-    Tournament replacement_op{};
-    PermutationWithRepetition<GT> encoder_decoder{};
-    TabuSearchVariableLength local_search{};
-
-    EvolutionaryAlgorithmLogger<Solution> evolutionary_logger(std::string("Evolutionary Algorithm"), true);
-    LocalSearchLogger<Solution> local_logger(std::string("Local Search"), true);
-
-    auto solution = MemeticAlgorithm::FindSolution(
-        evolutionary_logger,
-        local_logger,
-        problem,
-        encoder_decoder,
-        generation_operator,
-        problem.GetNumberOfJobs() * problem.GetNumberOfMachines(),
-        selection_op,
-        crossover_op,
-        1,
-        mutation_op,
-        0.1,
-        replacement_op,
-        false,
-        [&problem](auto, auto no_improving_generations, auto average_quality, auto best_solution_quality) {
-            return no_improving_generations > problem.GetNumberOfJobs() || AlmostEqual(best_solution_quality, average_quality);
-        },
-        rng,
-        local_search,
-        1,
-        problem.GetNumberOfJobs() + problem.GetNumberOfMachines(),
-        2 * (problem.GetNumberOfJobs() + problem.GetNumberOfMachines()),
-        [&problem](auto, auto no_improving_iterations) {
-            return no_improving_iterations > 2 * problem.GetNumberOfJobs() + problem.GetNumberOfMachines();
-        },
-        CET<Problem>());
-
-    return std::tie(solution, evolutionary_logger, local_logger);
-}
+#ifdef JSP_INSTRUMENTATION
+#include <utils/count_allocations.hpp>
+#endif
 
 int main(int argc, char** argv)
 {
@@ -96,19 +56,62 @@ int main(int argc, char** argv)
     using ProblemType = JSP<TaskType, JobType, MachineType>;
     using SolutionType = JSPTotalWeightedTardinessMinimizationSolution<ProblemType>;
 
-    std::ifstream instance(argv[1]);
     std::ofstream trace(argv[2]);
-    auto problem = read_standard_due_dates<TaskType, JobType, MachineType>(instance);
+    auto problem = JSPBinaryInstance::IsBinaryInstance(argv[1]) ? read_binary<TaskType, JobType, MachineType>(argv[1])
+                                                                : read_standard_due_dates_file<TaskType, JobType, MachineType>(argv[1]);
+
+    // optional wall-clock budget in milliseconds, the best solution found is published as soon as it is found
+    SearchBudget budget = argc > 3 ? SearchBudget(std::chrono::milliseconds(std::stoul(argv[3]))) : SearchBudget();
+    const auto publish = [&budget](const SolutionType& best) {
+        std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(budget.Elapsed()).count()
+                  << " ms: Total Weighted Tardiness = " << best.GetTotalWeightedTardiness() << std::endl;
+    };
+
+    // optional seed, all the random numbers of the run are derived from it
+    Philox4x32 rng(argc > 5 ? std::stoull(argv[5]) : (static_cast<std::uint64_t>(std::random_device{}()) << 32 | std::random_device{}()));
+    // optional machine sequence (as printed by SolutionSequence) of a previous schedule, the search starts around it
+    std::vector<unsigned int> initial_chromosome;
+    if (argc > 6 && std::string(argv[6]) != "-") {
+        std::ifstream sequence(argv[6]);
+        if (!sequence) {
+            throw std::invalid_argument("cannot open " + std::string(argv[6]));
+        }
+        initial_chromosome = JSPWarmStart::GetChromosome(JSPWarmStart::ReadSequence(sequence), problem);
+    }
+
+    // optional checkpoint file, written every minute; if it exists the search is resumed from it
+    std::unique_ptr<Checkpointer> checkpointer = argc > 7 ? std::make_unique<Checkpointer>(argv[7]) : nullptr;
 
-    std::clock_t start = std::clock();
-    auto [solution, evolutionary_logger, local_search_logger] = MemeticAlgorithm<ProblemType, SolutionType>(problem);
-    std::clock_t end = std::clock();
+    const auto run = [&](auto& evolutionary_logger, auto& local_logger) {
+        const auto solve = [&](const auto& generation_op) {
+            return checkpointer ? JSPSolvers::Memetic(evolutionary_logger, local_logger, budget, publish, problem, rng, generation_op, *checkpointer)
+                                : JSPSolvers::Memetic(evolutionary_logger, local_logger, budget, publish, problem, rng, generation_op);
+        };
+        std::clock_t start = std::clock();
+        auto solution =
+            initial_chromosome.empty() ? solve(JSPRandomPopulationGenerator{}) : solve(JSPWarmStartPopulationGenerator(initial_chromosome));
+        std::clock_t end = std::clock();
 
-    trace << "Execution Time = " << end - start << std::endl;
-    trace << "Total Weighted Tardiness = " << solution.GetTotalWeightedTardiness() << std::endl;
-    trace << "Expected Total Weighted Tardiness = " << solution.GetTotalWeightedTardiness().ExpectedValue() << std::endl;
-    trace << "TRACE" << std::endl;
-    trace << evolutionary_logger;
+        trace << "Execution Time = " << end - start << std::endl;
+        trace << "Total Weighted Tardiness = " << solution.GetTotalWeightedTardiness() << std::endl;
+        trace << "Expected Total Weighted Tardiness = " << solution.GetTotalWeightedTardiness().ExpectedValue() << std::endl;
+        trace << "Lower Bound = " << JSPLowerBounds::TotalWeightedTardiness(problem) << std::endl;
+        trace << "Gap = " << JSPSolvers::Gap(JSPSolvers::ObjectiveValue(solution), JSPSolvers::LowerBound<SolutionType>(problem)) << std::endl;
+        trace << "TRACE" << std::endl;
+        trace << evolutionary_logger;
+    };
+
+    // optional binary trace, streamed to disk while the algorithm runs (decode it with scripts/plot/decode_trace.py)
+    if (argc > 4 && std::string(argv[4]) != "-") {
+        TraceWriter writer(argv[4]);
+        TraceEvolutionaryAlgorithmLogger<SolutionType> evolutionary_logger(writer);
+        TraceLocalSearchLogger<SolutionType> local_logger(writer);
+        run(evolutionary_logger, local_logger);
+    } else {
+        EvolutionaryAlgorithmLogger<SolutionType> evolutionary_logger(std::string("Evolutionary Algorithm"), true);
+        NullLocalSearchLogger<SolutionType> local_logger;
+        run(evolutionary_logger, local_logger);
+    }
 
     return 0;
 }
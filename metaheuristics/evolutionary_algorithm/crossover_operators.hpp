@@ -19,6 +19,7 @@
 #include <vector>
 
 #include <utils/container_utils.hpp>
+#include <utils/instrumentation.hpp>
 
 /**
  * @brief GOX (Generalized Order Crossover) crossover operator.
@@ -119,8 +120,9 @@ class GOX
      */
     template <typename InputIt1, typename InputIt2, typename OutputIt1, typename OutputIt2, typename RNG>
     static std::pair<OutputIt1, OutputIt2>
-    Cross(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt1 dest1, OutputIt2 dest2, RNG rng)
+    Cross(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt1 dest1, OutputIt2 dest2, RNG& rng)
     {
+        JSP_SCOPED_TIMER(Probe::Cross);
         using Gene = typename std::iterator_traits<InputIt1>::value_type;
 
         if (std::distance(first1, last1) != std::distance(first2, last2)) {
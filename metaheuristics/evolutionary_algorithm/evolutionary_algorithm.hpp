@@ -14,9 +14,11 @@
 #include <algorithm>
 #include <numeric>
 #include <random>
+#include <type_traits>
 #include <unordered_set>
 
 #include <metaheuristics/utils/evolutionary_algorithm_logger.hpp>
+#include <metaheuristics/utils/search_budget.hpp>
 #include <utils/container_utils.hpp>
 
 /**
@@ -91,6 +93,8 @@ class EvolutionaryAlgorithm
      * @brief Finds a solution to a problem using a evolutionary algorithm metaheuristic.
      * 
      * @tparam Solution type of the solution to be evaluated.
+     * @tparam Logger type of the logger, EvolutionaryAlgorithmLogger or NullEvolutionaryAlgorithmLogger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
      * @tparam Problem type of the problem to be evaluated.
      * @tparam EncoderDecoder type of the encoder/decoder to be used to evaluate the chromosomes.
      * @tparam GenerationOp type of the generation operator to be used to generate the initial population.
@@ -101,9 +105,11 @@ class EvolutionaryAlgorithm
      * @tparam ReplacementOp type of the replacement operator to be used to select the new generation.
      * @tparam RNG type of the random number generator.
      * @param logger logger where a trace of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
      * @param problem problem to be solved.
      * @param encoder_decoder encoder/decoder to be used to evaluate the chromosomes.
-     * @param generation_op generation operator to be used to generate the initial population.
+     * @param generation_op generation operator to be used to generate the initial population, which is cut short if the budget is exhausted.
      * @param population_size population size (number of individuals in the population).
      * @param selection_op selection operator to be used to choose the couples of individuals that will reproduce.
      * @param crossover_op crossover operator to be used to cross the selected couples.
@@ -117,6 +123,9 @@ class EvolutionaryAlgorithm
      * @return the best solution found.
      */
     template <typename Solution,
+              template <typename>
+              class Logger,
+              typename ImprovementCallback,
               typename Problem,
               typename EncoderDecoder,
               typename GenerationOp,
@@ -126,7 +135,9 @@ class EvolutionaryAlgorithm
               typename ReplacementOp,
               typename StoppingCriterion,
               typename RNG>
-    static Solution FindSolution(EvolutionaryAlgorithmLogger<Solution>& logger,
+    static Solution FindSolution(Logger<Solution>& logger,
+                                 SearchBudget& budget,
+                                 const ImprovementCallback& improvement_callback,
                                  const Problem& problem,
                                  const EncoderDecoder& encoder_decoder,
                                  const GenerationOp& generation_op,
@@ -148,17 +159,15 @@ class EvolutionaryAlgorithm
         // create the initial population
         Population population;
         {
-            std::vector<SolutionType> raw_population;
-            generation_op.template GetIndividuals<Solution>(std::back_inserter(raw_population), problem, population_size, rng);
-            std::transform(std::make_move_iterator(raw_population.begin()),
-                           std::make_move_iterator(raw_population.end()),
-                           std::inserter(population, population.begin()),
-                           [&encoder_decoder](const auto& i) {
-                               Individual individual;
-                               encoder_decoder.EncodeSolution(std::back_inserter(individual.chromosome), i);
-                               individual.quality = i.GetQuality();
-                               return individual;
-                           });
+            // each solution is encoded as soon as it is generated, so the encoding is also bounded by the budget
+            const auto encode = [&encoder_decoder](const SolutionType& solution) {
+                Individual individual;
+                encoder_decoder.EncodeSolution(std::back_inserter(individual.chromosome), solution);
+                individual.quality = solution.GetQuality();
+                return individual;
+            };
+            generation_op.template GetIndividuals<Solution>(
+                make_transform_output_iterator(std::inserter(population, population.begin()), encode), problem, population_size, rng, budget);
         }
 
         // random number generator
@@ -167,6 +176,14 @@ class EvolutionaryAlgorithm
         // keep the best solution
         Individual best_solution =
             *std::max_element(population.begin(), population.end(), [](const auto& t1, const auto& t2) { return t1.quality < t2.quality; });
+        // publish the best solution each time it improves
+        const auto publish_best_solution = [&]() {
+            if constexpr (!std::is_same<ImprovementCallback, IgnoreImprovements>::value) {
+                auto chromosome = best_solution.chromosome;
+                improvement_callback(encoder_decoder.template DecodeSolution<Solution>(chromosome.begin(), chromosome.end(), problem));
+            }
+        };
+        publish_best_solution();
         // number of generations
         unsigned int generations = 0;
         // number of generations without improving
@@ -179,7 +196,8 @@ class EvolutionaryAlgorithm
             logger.AddLog(average_quality, best_solution.quality);
         }
 
-        while (!stopping_criterion(generations++, no_improving_generations++, average_quality, best_solution.quality)) // termination criterion
+        while (!budget.Exhausted() &&
+               !stopping_criterion(generations++, no_improving_generations++, average_quality, best_solution.quality)) // termination criterion
         {
             Population new_generation;
             // elitism, the global best always pass to the next generation
@@ -189,7 +207,12 @@ class EvolutionaryAlgorithm
             // select the couples that will reproduce
             std::vector<Couple> couples;
             selection_op.Select(population.begin(), population.end(), std::back_insert_iterator(couples), population_size / 2, rng);
+            bool interrupted = false; // true if the budget is exhausted in the middle of the generation
             for (const auto& [parent1, parent2]: couples) {
+                if (budget.ExhaustedNow()) {
+                    interrupted = true;
+                    break;
+                }
                 // cross the individuals
                 Individual offspring1;
                 Individual offspring2;
@@ -220,12 +243,14 @@ class EvolutionaryAlgorithm
                 } else {
                     offspring1.quality = encoder_decoder.template EvaluateSolutionQuality<Solution>(
                         offspring1.chromosome.begin(), offspring1.chromosome.end(), problem);
+                    budget.AddEvaluations(1);
                 }
                 if (population.count(offspring2) != 0) {
                     offspring2.quality = population.find(offspring2)->quality;
                 } else {
                     offspring2.quality = encoder_decoder.template EvaluateSolutionQuality<Solution>(
                         offspring2.chromosome.begin(), offspring2.chromosome.end(), problem);
+                    budget.AddEvaluations(1);
                 }
 
                 // select the individuals that will pass to the next generation
@@ -236,14 +261,27 @@ class EvolutionaryAlgorithm
                 new_generation.insert(descendant2);
 
                 // check if any of the offsprings is the global best
+                bool improved = false;
                 if (descendant1.get().quality > best_solution.quality) {
                     best_solution = descendant1;
                     no_improving_generations = 0;
+                    improved = true;
                 }
                 if (descendant2.get().quality > best_solution.quality) {
                     best_solution = descendant2;
                     no_improving_generations = 0;
+                    improved = true;
+                }
+                if (improved) {
+                    publish_best_solution();
+                }
+            }
+            // an incomplete generation is discarded, its best individual has already been kept
+            if (interrupted) {
+                if (logger) {
+                    logger.AddLog(average_quality, best_solution.quality, EvolutionaryAlgorithmLogMessage::BudgetExhausted);
                 }
+                break;
             }
             // set the new generation as the current generation
             population = std::move(new_generation);
@@ -0,0 +1,111 @@
+/**
+ * @file local_search_policies.hpp
+ * @author Pablo
+ * @brief Policies that decide which offsprings of a memetic algorithm are improved with the local search.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef LOCALSEARCHPOLICIES_HPP_
+#define LOCALSEARCHPOLICIES_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+/**
+ * @brief Adaptive local search policy. The memetic algorithms usually improve every offspring, but many of them are
+ * near-duplicates of a parent, whose local search ends in the local optimum of the parent, or are so poor that their
+ * local search rarely yields an individual that survives the replacement. This policy:
+ * - does not improve the offsprings whose chromosomes are too close to one of their parents;
+ * - improves the promising offsprings, those whose quality is not lower than the moving average of the quality of the
+ *   offsprings, with a complete local search;
+ * - improves the rest of the offsprings with a probability equal to the observed rate of success of their local searches
+ *   (an improved offspring succeeds if it is better than its worst parent), which is never lower than a minimum so the rate
+ *   keeps being observed, and their local searches are limited to the average evaluations of the complete local searches.
+ * 
+ * The policy is stateful, the algorithms use a copy of it for each run. Its state is not part of the checkpoints,
+ * so a resumed search starts with a fresh policy.
+ * 
+ */
+class AdaptiveLocalSearch
+{
+  public:
+    static constexpr unsigned long long unlimited = std::numeric_limits<unsigned long long>::max(); // allowance of a complete local search
+
+  private:
+    double min_distance; // minimum distance of an offspring to its parents to be improved, as the fraction of different genes
+    double min_rate; // minimum probability of improving an offspring that is not promising
+    double memory; // weight of the last observation in the moving averages
+    double mean_quality; // moving average of the quality of the offsprings before being improved
+    double success_rate; // moving average of the success of the local searches of the offsprings that are not promising
+    double mean_evaluations; // moving average of the evaluations of the complete local searches
+    bool promising; // true if the last offspring was promising
+
+  public:
+    /**
+     * @brief Constructs a new AdaptiveLocalSearch.
+     * 
+     * @param min_distance minimum distance of an offspring to its parents to be improved, as the fraction of different genes.
+     * @param min_rate minimum probability of improving an offspring that is not promising.
+     * @param memory weight of the last observation in the moving averages of the policy.
+     */
+    explicit AdaptiveLocalSearch(double min_distance = 0.02, double min_rate = 0.1, double memory = 0.05) :
+        min_distance{min_distance},
+        min_rate{min_rate},
+        memory{memory},
+        mean_quality{std::numeric_limits<double>::quiet_NaN()},
+        success_rate{1.0},
+        mean_evaluations{0.0},
+        promising{true}
+    {}
+
+    /**
+     * @brief Decides if an offspring is improved, and with how many evaluations.
+     * 
+     * @tparam RNG type of the random number generator.
+     * @param quality quality of the offspring.
+     * @param distance distance of the offspring to its closest parent, as the fraction of different genes.
+     * @param rng random number generator.
+     * @return the maximum number of evaluations of the local search, unlimited for a complete local search, or zero if the
+     * offspring is not improved.
+     */
+    template <typename RNG> unsigned long long Allowance(double quality, double distance, RNG& rng)
+    {
+        if (distance < min_distance) {
+            return 0;
+        }
+        promising = !(quality < mean_quality);
+        mean_quality = std::isnan(mean_quality) ? quality : mean_quality + memory * (quality - mean_quality);
+        if (promising) {
+            return unlimited;
+        }
+        std::uniform_real_distribution<double> dis(0.0, 1.0);
+        if (dis(rng) >= std::max(min_rate, success_rate)) {
+            return 0;
+        }
+        return mean_evaluations > 0 ? static_cast<unsigned long long>(std::ceil(mean_evaluations)) : unlimited;
+    }
+
+    /**
+     * @brief Reports the outcome of the local search of the last offspring whose allowance was not zero.
+     * 
+     * @param allowance allowance of the local search.
+     * @param evaluations evaluations consumed by the local search.
+     * @param success true if the improved offspring is better than its worst parent.
+     */
+    void Report(unsigned long long allowance, unsigned long long evaluations, bool success)
+    {
+        if (allowance == unlimited) {
+            mean_evaluations = mean_evaluations > 0 ? mean_evaluations + memory * (evaluations - mean_evaluations) : evaluations;
+        }
+        if (!promising) {
+            success_rate += memory * ((success ? 1.0 : 0.0) - success_rate);
+        }
+    }
+};
+
+#endif /* LOCALSEARCHPOLICIES_HPP_ */
@@ -12,16 +12,27 @@
 #define MEMETICALGORITHM_HPP_
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <numeric>
 #include <random>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
+#include <metaheuristics/utils/checkpoint.hpp>
 #include <metaheuristics/utils/evolutionary_algorithm_logger.hpp>
 #include <metaheuristics/utils/local_search_logger.hpp>
+#include <metaheuristics/utils/search_budget.hpp>
 #include <utils/container_utils.hpp>
 
 /**
- * @brief Provides static functions to run a memetic algorithm.
+ * @brief Provides static functions to run a memetic algorithm, generational or steady-state.
  * 
  */
 class MemeticAlgorithm
@@ -37,6 +48,7 @@ class MemeticAlgorithm
 
         Chromosome chromosome; // the chromosome of the individual
         double quality; // the quality (fitness) of the individual
+        std::uint64_t schedule = 0; // Zobrist hash of the schedule of the individual, zero if unknown
 
         /**
          * @brief Returns the quality (fitness) of the individual.
@@ -87,11 +99,229 @@ class MemeticAlgorithm
         }
     };
 
+    /**
+     * @brief Checks that a checkpoint can be resumed for a problem: it must belong to the same instance, if the checkpoint
+     * knows its instance, and all its individuals must encode solutions of the problem.
+     * 
+     * @tparam Problem type of the problem.
+     * @tparam EncoderDecoder type of the encoder-decoder.
+     * @param state checkpoint to be resumed.
+     * @param instance fingerprint of the instance of the problem.
+     * @param problem problem to be solved.
+     * @param encoder_decoder encoder-decoder of the individuals.
+     * @param max_population_size maximum size of the population of the algorithm.
+     * @throws std::invalid_argument if the checkpoint cannot be resumed for the problem.
+     */
+    template <typename Problem, typename EncoderDecoder>
+    static void CheckCheckpoint(const EvolutionaryCheckpoint& state,
+                                const EvolutionaryCheckpoint::InstanceFingerprint& instance,
+                                const Problem& problem,
+                                const EncoderDecoder& encoder_decoder,
+                                std::size_t max_population_size)
+    {
+        if (state.instance != EvolutionaryCheckpoint::InstanceFingerprint{} && state.instance != instance) {
+            throw std::invalid_argument("the checkpoint belongs to another instance");
+        }
+        if (state.population.size() > max_population_size) {
+            throw std::invalid_argument("the population of the checkpoint is larger than the population of the algorithm");
+        }
+        const auto valid = [&problem, &encoder_decoder](const EvolutionaryCheckpoint::Individual& individual) {
+            return encoder_decoder.IsValidChromosome(individual.chromosome.begin(), individual.chromosome.end(), problem);
+        };
+        if (!valid(state.best) || !std::all_of(state.population.begin(), state.population.end(), valid)) {
+            throw std::invalid_argument("invalid chromosome in the checkpoint");
+        }
+    }
+
+    /**
+     * @brief Rebuilds a population inserting its individuals in lexicographical order of their chromosomes, so the order
+     * in which the population is traversed only depends on its individuals and not on the order in which they were inserted.
+     * 
+     * @tparam Population type of the population.
+     * @param population population to be rebuilt.
+     */
+    template <typename Population> static void Canonicalize(Population& population)
+    {
+        std::vector<Individual> individuals;
+        individuals.reserve(population.size());
+        while (!population.empty()) {
+            individuals.push_back(std::move(population.extract(population.begin()).value()));
+        }
+        std::sort(individuals.begin(), individuals.end(), [](const Individual& i1, const Individual& i2) {
+            return std::tie(i1.chromosome, i1.quality) < std::tie(i2.chromosome, i2.quality);
+        });
+        Population canonical;
+        for (auto& individual: individuals) {
+            canonical.insert(std::move(individual));
+        }
+        population = std::move(canonical);
+    }
+
+    /**
+     * @brief Improves an offspring with the local search or else evaluates it, taking its quality from the population if it
+     * is already there. The local search policy is either the probability of improving the offspring, or an adaptive policy
+     * like AdaptiveLocalSearch that decides from the quality of the offspring and its distance to its parents if it is improved
+     * and with how many evaluations.
+     * 
+     * @param offspring offspring whose chromosome is improved and whose quality is set.
+     * @param parent1 first parent of the offspring.
+     * @param parent2 second parent of the offspring.
+     * @param message message of the log of the local search.
+     * @param generations number of generations, for the log of the local search.
+     * @param find function that returns a pointer to an individual of the population with the same chromosome, or null.
+     * @param local_search_policy improvement probability or adaptive local search policy.
+     */
+    template <typename Solution,
+              template <typename>
+              class LocalLogger,
+              typename Problem,
+              typename EncoderDecoder,
+              typename Find,
+              typename RNG,
+              typename LocalSearch,
+              typename LocalSearchPolicy,
+              typename... LocalSearchArgs>
+    static void Improve(Individual& offspring,
+                        const Individual& parent1,
+                        const Individual& parent2,
+                        LocalSearchLogMessage message,
+                        unsigned int generations,
+                        LocalLogger<Solution>& local_logger,
+                        SearchBudget& budget,
+                        const Problem& problem,
+                        const EncoderDecoder& encoder_decoder,
+                        const Find& find,
+                        const LocalSearch& local_search,
+                        LocalSearchPolicy& local_search_policy,
+                        RNG& rng,
+                        const LocalSearchArgs&... args)
+    {
+        if constexpr (std::is_arithmetic<LocalSearchPolicy>::value) {
+            std::uniform_real_distribution<double> dis(0.0, 1.0);
+            if (dis(rng) < local_search_policy) {
+                auto decoded_offspring =
+                    encoder_decoder.template DecodeSolution<Solution>(offspring.chromosome.begin(), offspring.chromosome.end(), problem);
+                budget.AddEvaluations(1);
+                if (local_logger) {
+                    local_logger.AddLog(decoded_offspring.GetQuality(), 1, 1, message, generations);
+                }
+                decoded_offspring = local_search.FindSolution(local_logger, budget, IgnoreImprovements{}, decoded_offspring, args...);
+                offspring.chromosome.clear();
+                encoder_decoder.EncodeSolution(std::back_inserter(offspring.chromosome), decoded_offspring);
+                offspring.quality = decoded_offspring.GetQuality();
+                offspring.schedule = decoded_offspring.GetHash();
+            } else if (const Individual* individual = find(offspring)) {
+                offspring.quality = individual->quality;
+                offspring.schedule = individual->schedule;
+            } else {
+                offspring.quality =
+                    encoder_decoder.template EvaluateSolutionQuality<Solution>(offspring.chromosome.begin(), offspring.chromosome.end(), problem);
+                budget.AddEvaluations(1);
+            }
+        } else {
+            // the individuals of the population are not improved again
+            if (const Individual* individual = find(offspring)) {
+                offspring.quality = individual->quality;
+                offspring.schedule = individual->schedule;
+                return;
+            }
+            auto decoded_offspring =
+                encoder_decoder.template DecodeSolution<Solution>(offspring.chromosome.begin(), offspring.chromosome.end(), problem);
+            budget.AddEvaluations(1);
+            offspring.quality = decoded_offspring.GetQuality();
+            offspring.schedule = decoded_offspring.GetHash();
+            const auto different_genes = [&offspring](const Individual& parent) {
+                std::size_t genes = 0;
+                for (std::size_t i = 0; i < offspring.chromosome.size() && i < parent.chromosome.size(); i++) {
+                    genes += offspring.chromosome[i] != parent.chromosome[i];
+                }
+                return genes;
+            };
+            const std::size_t genes = std::min(different_genes(parent1), different_genes(parent2));
+            double distance = static_cast<double>(genes) / std::max<std::size_t>(offspring.chromosome.size(), 1);
+            unsigned long long allowance = local_search_policy.Allowance(offspring.quality, distance, rng);
+            if (allowance == 0) {
+                return;
+            }
+            if (local_logger) {
+                local_logger.AddLog(decoded_offspring.GetQuality(), 1, 1, message, generations);
+            }
+            SearchBudget slice = budget.Slice(allowance);
+            decoded_offspring = local_search.FindSolution(local_logger, slice, IgnoreImprovements{}, decoded_offspring, args...);
+            local_search_policy.Report(allowance,
+                                       slice.GetEvaluations() - budget.GetEvaluations(),
+                                       decoded_offspring.GetQuality() > std::min(parent1.quality, parent2.quality));
+            budget.AddEvaluations(slice.GetEvaluations() - budget.GetEvaluations());
+            offspring.chromosome.clear();
+            encoder_decoder.EncodeSolution(std::back_inserter(offspring.chromosome), decoded_offspring);
+            offspring.quality = decoded_offspring.GetQuality();
+            offspring.schedule = decoded_offspring.GetHash();
+        }
+    }
+
+    /**
+     * @brief Replaces the descendants chosen by the replacement operator that duplicate the schedule of an individual already
+     * in the population, or of the other descendant, with the best of the other candidates (the parents and the offsprings)
+     * whose schedule is new. If there are not enough of them, the chosen descendants are kept.
+     * 
+     * @param chosen descendants chosen by the replacement operator.
+     * @param parent1 first parent.
+     * @param parent2 second parent.
+     * @param offspring1 first offspring.
+     * @param offspring2 second offspring.
+     * @param in_population function that checks if a schedule hash is already in the population.
+     * @return a pair with the descendants.
+     */
+    template <typename InPopulation>
+    static std::pair<std::reference_wrapper<const Individual>, std::reference_wrapper<const Individual>>
+    Deduplicate(const std::pair<std::reference_wrapper<const Individual>, std::reference_wrapper<const Individual>>& chosen,
+                const Individual& parent1,
+                const Individual& parent2,
+                const Individual& offspring1,
+                const Individual& offspring2,
+                const InPopulation& in_population)
+    {
+        const Individual& chosen1 = chosen.first;
+        const Individual& chosen2 = chosen.second;
+        const auto is_new = [&in_population](const Individual& individual) {
+            return individual.schedule == 0 || !in_population(individual.schedule);
+        };
+        if (is_new(chosen1) && is_new(chosen2) && (chosen1.schedule == 0 || chosen1.schedule != chosen2.schedule)) {
+            return chosen;
+        }
+        std::vector<std::reference_wrapper<const Individual>> candidates = {chosen1, chosen2};
+        std::vector<std::reference_wrapper<const Individual>> others;
+        for (const Individual& individual: {std::cref(parent1), std::cref(parent2), std::cref(offspring1), std::cref(offspring2)}) {
+            if (&individual != &chosen1 && &individual != &chosen2) {
+                others.push_back(individual);
+            }
+        }
+        std::stable_sort(others.begin(), others.end(), std::greater<Individual>());
+        candidates.insert(candidates.end(), others.begin(), others.end());
+        std::vector<std::reference_wrapper<const Individual>> descendants;
+        for (const Individual& candidate: candidates) {
+            if (descendants.size() < 2 && is_new(candidate) &&
+                (descendants.empty() || candidate.schedule == 0 || candidate.schedule != descendants.front().get().schedule)) {
+                descendants.push_back(candidate);
+            }
+        }
+        for (const Individual& candidate: {std::cref(chosen1), std::cref(chosen2)}) {
+            if (descendants.size() < 2 && (descendants.empty() || &descendants.front().get() != &candidate)) {
+                descendants.push_back(candidate);
+            }
+        }
+        return std::make_pair(descendants.at(0), descendants.at(1));
+    }
+
   public:
     /**
      * @brief Finds a solution to a problem using a memetic algorithm metaheuristic.
      * 
      * @tparam Solution type of the solution to be evaluated.
+     * @tparam EvolutionaryLogger type of the evolutionary logger, EvolutionaryAlgorithmLogger or NullEvolutionaryAlgorithmLogger.
+     * @tparam LocalLogger type of the local logger, LocalSearchLogger or NullLocalSearchLogger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Checkpointer type of the checkpointer, Checkpointer or IgnoreCheckpoints.
      * @tparam Problem type of the problem to be evaluated.
      * @tparam EncoderDecoder type of the encoder/decoder to be used to evaluate the chromosomes.
      * @tparam GenerationOp type of the generation operator to be used to generate the initial population.
@@ -102,12 +332,18 @@ class MemeticAlgorithm
      * @tparam StoppingCriterion type of the stopping criterion to be used to terminate the algorithm.
      * @tparam RNG type of the random number generator.
      * @tparam LocalSearch type of the local search metaheuristic to be used to improve the individuals.
+     * @tparam LocalSearchPolicy type of the local search policy, a probability or a policy like AdaptiveLocalSearch.
      * @tparam LocalSearchArgs type of the arguments of the local search metaheuristic.
      * @param evolutionary_logger logger where a trace of the evolutionary part of the execution will be stored.
      * @param local_logger logger where a trace of the local parts of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param checkpointer checkpointer where the state of the search is periodically saved and from which it is resumed.
+     * When checkpoints are enabled the population is kept in a canonical order, so a resumed search goes on exactly as
+     * the original one (the elapsed time is not part of the state, so it only holds for budgets without a time limit).
      * @param problem problem to be solved.
      * @param encoder_decoder encoder/decoder to be used to evaluate the chromosomes.
-     * @param generation_op generation operator to be used to generate the initial population.
+     * @param generation_op generation operator to be used to generate the initial population, which is cut short if the budget is exhausted.
      * @param population_size population size (number of individuals in the population).
      * @param selection_op selection operator to be used to choose the couples of individuals that will reproduce.
      * @param crossover_op crossover operator to be used to cross the selected couples.
@@ -119,11 +355,18 @@ class MemeticAlgorithm
      * @param elitism if true the best individual of each generation will pass untouched to the next generation.
      * @param rng random number generator to be used.
      * @param local_search local search metaheuristic to be used to improve the individuals.
-     * @param local_search_prob improvement probability.
+     * @param local_search_policy improvement probability, or policy that decides which offsprings are improved and with how many
+     * evaluations, like AdaptiveLocalSearch. A copy of the policy is used, and its state is not part of the checkpoints.
      * @param args arguments of the local search metaheuristic.
      * @return the best solution found. 
      */
     template <typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Checkpointer,
               typename Problem,
               typename EncoderDecoder,
               typename GenerationOp,
@@ -134,9 +377,13 @@ class MemeticAlgorithm
               typename StoppingCriterion,
               typename RNG,
               typename LocalSearch,
+              typename LocalSearchPolicy,
               typename... LocalSearchArgs>
-    static Solution FindSolution(EvolutionaryAlgorithmLogger<Solution>& evolutionary_logger,
-                                 LocalSearchLogger<Solution>& local_logger,
+    static Solution FindSolution(EvolutionaryLogger<Solution>& evolutionary_logger,
+                                 LocalLogger<Solution>& local_logger,
+                                 SearchBudget& budget,
+                                 const ImprovementCallback& improvement_callback,
+                                 Checkpointer& checkpointer,
                                  const Problem& problem,
                                  const EncoderDecoder& encoder_decoder,
                                  const GenerationOp& generation_op,
@@ -151,58 +398,123 @@ class MemeticAlgorithm
                                  const StoppingCriterion& stopping_criterion,
                                  RNG& rng,
                                  const LocalSearch& local_search,
-                                 double local_search_prob,
+                                 const LocalSearchPolicy& local_search_policy,
                                  const LocalSearchArgs&... args)
     {
         using SolutionType = Solution;
         using Population = std::unordered_multiset<Individual, IndividualHash>;
         using Couple = std::pair<std::reference_wrapper<const Individual>, std::reference_wrapper<const Individual>>;
 
+        constexpr bool checkpoints = !std::is_same<Checkpointer, IgnoreCheckpoints>::value;
+        LocalSearchPolicy policy = local_search_policy; // the policies can learn along the search
+        // state from which the search is resumed, then state at the end of the last complete generation
+        EvolutionaryCheckpoint state;
+        bool resuming = false;
+        if constexpr (checkpoints) {
+            const auto instance = EvolutionaryCheckpoint::Fingerprint(problem);
+            resuming = checkpointer.Resume(state);
+            if (resuming) {
+                // the elitism keeps the best individual besides the offsprings of the couples
+                CheckCheckpoint(state, instance, problem, encoder_decoder, population_size + (elitism ? 1 : 0));
+            }
+            state.instance = instance;
+        }
+
         // create the initial population
         Population population;
-        {
-            std::vector<SolutionType> raw_population;
-            generation_op.template GetIndividuals<Solution>(std::back_inserter(raw_population), problem, population_size, rng);
-            std::transform(std::make_move_iterator(raw_population.begin()),
-                           std::make_move_iterator(raw_population.end()),
-                           std::inserter(population, population.begin()),
-                           [&encoder_decoder](const auto& i) {
-                               Individual individual;
-                               encoder_decoder.EncodeSolution(std::back_inserter(individual.chromosome), i);
-                               individual.quality = i.GetQuality();
-                               return individual;
-                           });
+        if (resuming) {
+            for (auto& individual: state.population) {
+                population.insert(Individual{std::move(individual.chromosome), individual.quality, individual.schedule});
+            }
+            budget.AddEvaluations(state.evaluations);
+            if constexpr (checkpoints) {
+                state.GetRNG(rng);
+            }
+        } else {
+            // each solution is encoded as soon as it is generated, so the encoding is also bounded by the budget
+            const auto encode = [&encoder_decoder](const SolutionType& solution) {
+                Individual individual;
+                encoder_decoder.EncodeSolution(std::back_inserter(individual.chromosome), solution);
+                individual.quality = solution.GetQuality();
+                individual.schedule = solution.GetHash();
+                return individual;
+            };
+            generation_op.template GetIndividuals<Solution>(
+                make_transform_output_iterator(std::inserter(population, population.begin()), encode), problem, population_size, rng, budget);
         }
 
         // random number generator
         std::uniform_real_distribution<double> dis(0.0, 1.0);
 
         // keep the best solution
-        Individual best_solution =
-            *std::max_element(population.begin(), population.end(), [](const auto& t1, const auto& t2) { return t1.quality < t2.quality; });
+        Individual best_solution = resuming ? Individual{state.best.chromosome, state.best.quality, state.best.schedule}
+                                            : *std::max_element(population.begin(), population.end(), [](const auto& t1, const auto& t2) {
+                                                  return t1.quality < t2.quality;
+                                              });
+        // publish the best solution each time it improves
+        const auto publish_best_solution = [&]() {
+            if constexpr (!std::is_same<ImprovementCallback, IgnoreImprovements>::value) {
+                auto chromosome = best_solution.chromosome;
+                improvement_callback(encoder_decoder.template DecodeSolution<Solution>(chromosome.begin(), chromosome.end(), problem));
+            }
+        };
+        publish_best_solution();
         // number of generations
-        unsigned int generations = 0;
+        unsigned int generations = resuming ? state.generations : 0;
         // number of generations without improving
-        unsigned int no_improving_generations = 0;
+        unsigned int no_improving_generations = resuming ? state.no_improving_generations : 0;
         // average quality of the solutions
         double average_quality =
-            std::accumulate(population.begin(), population.end(), 0.0, [](const auto& t1, const auto& t2) { return t1 + t2.quality; }) /
-            population.size();
+            resuming ? state.average_quality
+                     : std::accumulate(population.begin(), population.end(), 0.0, [](const auto& t1, const auto& t2) { return t1 + t2.quality; }) /
+                           population.size();
         if (evolutionary_logger) {
             evolutionary_logger.AddLog(average_quality, best_solution.quality);
         }
 
-        while (!stopping_criterion(generations++, no_improving_generations++, average_quality, best_solution.quality)) // termination criterion
+        // the population is not kept in the state, it does not change until the next generation is complete
+        state.population.clear();
+        const auto end_generation = [&]() {
+            if constexpr (checkpoints) {
+                Canonicalize(population);
+                state.generations = generations;
+                state.no_improving_generations = no_improving_generations;
+                state.evaluations = budget.GetEvaluations();
+                state.average_quality = average_quality;
+                state.best = {best_solution.chromosome, best_solution.quality, best_solution.schedule};
+                state.SetRNG(rng);
+            }
+        };
+        const auto save_checkpoint = [&]() {
+            if constexpr (checkpoints) {
+                EvolutionaryCheckpoint checkpoint = state;
+                for (const auto& individual: population) {
+                    checkpoint.population.push_back({individual.chromosome, individual.quality, individual.schedule});
+                }
+                checkpointer.Save(std::move(checkpoint));
+            }
+        };
+        end_generation();
+
+        while (!budget.Exhausted() &&
+               !stopping_criterion(generations++, no_improving_generations++, average_quality, best_solution.quality)) // termination criterion
         {
             Population new_generation;
+            std::unordered_set<std::uint64_t> schedules; // hashes of the schedules in the new generation
             // elitism, the global best always pass to the next generation
             if (elitism) {
                 new_generation.insert(best_solution);
+                schedules.insert(best_solution.schedule);
             }
             // select the couples that will reproduce
             std::vector<Couple> couples;
             selection_op.Select(population.begin(), population.end(), std::back_insert_iterator(couples), population_size / 2, rng);
+            bool interrupted = false; // true if the budget is exhausted in the middle of the generation
             for (const auto& [parent1, parent2]: couples) {
+                if (budget.ExhaustedNow()) {
+                    interrupted = true;
+                    break;
+                }
                 // cross the individuals
                 Individual offspring1;
                 Individual offspring2;
@@ -228,61 +540,76 @@ class MemeticAlgorithm
                 }
 
                 // improve the offsprings
-                if (dis(rng) < local_search_prob) {
-                    auto decoded_offspring1 =
-                        encoder_decoder.template DecodeSolution<Solution>(offspring1.chromosome.begin(), offspring1.chromosome.end(), problem);
-                    if (local_logger) {
-                        local_logger.AddLog(
-                            decoded_offspring1.GetQuality(), 1, 1, "Restart solution. Offspring1. Iteration: " + std::to_string(generations));
-                    }
-                    decoded_offspring1 = local_search.FindSolution(local_logger, decoded_offspring1, args...);
-                    offspring1.chromosome.clear();
-                    encoder_decoder.EncodeSolution(std::back_inserter(offspring1.chromosome), decoded_offspring1);
-                    offspring1.quality = decoded_offspring1.GetQuality();
-                } else {
-                    if (population.count(offspring1) != 0) {
-                        offspring1.quality = population.find(offspring1)->quality;
-                    } else {
-                        offspring1.quality = encoder_decoder.template EvaluateSolutionQuality<Solution>(
-                            offspring1.chromosome.begin(), offspring1.chromosome.end(), problem);
-                    }
-                }
-                if (dis(rng) < local_search_prob) {
-                    auto decoded_offspring2 =
-                        encoder_decoder.template DecodeSolution<Solution>(offspring2.chromosome.begin(), offspring2.chromosome.end(), problem);
-                    if (local_logger) {
-                        local_logger.AddLog(
-                            decoded_offspring2.GetQuality(), 1, 1, "Restart solution. Offspring2. Iteration: " + std::to_string(generations));
-                    }
-                    decoded_offspring2 = local_search.FindSolution(local_logger, decoded_offspring2, args...);
-                    offspring2.chromosome.clear();
-                    encoder_decoder.EncodeSolution(std::back_inserter(offspring2.chromosome), decoded_offspring2);
-                    offspring2.quality = decoded_offspring2.GetQuality();
-                } else {
-                    if (population.count(offspring2) != 0) {
-                        offspring2.quality = population.find(offspring2)->quality;
-                    } else {
-                        offspring2.quality = encoder_decoder.template EvaluateSolutionQuality<Solution>(
-                            offspring2.chromosome.begin(), offspring2.chromosome.end(), problem);
-                    }
-                }
+                const auto find = [&population](const Individual& individual) {
+                    auto it = population.find(individual);
+                    return it != population.end() ? &*it : nullptr;
+                };
+                Improve(offspring1,
+                        parent1.get(),
+                        parent2.get(),
+                        LocalSearchLogMessage::RestartOffspring1,
+                        generations,
+                        local_logger,
+                        budget,
+                        problem,
+                        encoder_decoder,
+                        find,
+                        local_search,
+                        policy,
+                        rng,
+                        args...);
+                Improve(offspring2,
+                        parent1.get(),
+                        parent2.get(),
+                        LocalSearchLogMessage::RestartOffspring2,
+                        generations,
+                        local_logger,
+                        budget,
+                        problem,
+                        encoder_decoder,
+                        find,
+                        local_search,
+                        policy,
+                        rng,
+                        args...);
 
-                // select the individuals that will pass to the next generation
-                const auto& [descendant1, descendant2] = replacement_op.Choose(parent1.get(), parent2.get(), offspring1, offspring2, rng);
+                // select the individuals that will pass to the next generation, without repeating schedules
+                const auto [descendant1, descendant2] =
+                    Deduplicate(replacement_op.Choose(parent1.get(), parent2.get(), offspring1, offspring2, rng),
+                                parent1.get(),
+                                parent2.get(),
+                                offspring1,
+                                offspring2,
+                                [&schedules](std::uint64_t schedule) { return schedules.count(schedule) != 0; });
 
                 // insert the descendants in the new generation
                 new_generation.insert(descendant1);
                 new_generation.insert(descendant2);
+                schedules.insert(descendant1.get().schedule);
+                schedules.insert(descendant2.get().schedule);
 
                 // check if any of the offsprings is the global best
+                bool improved = false;
                 if (descendant1.get().quality > best_solution.quality) {
                     best_solution = descendant1;
                     no_improving_generations = 0;
+                    improved = true;
                 }
                 if (descendant2.get().quality > best_solution.quality) {
                     best_solution = descendant2;
                     no_improving_generations = 0;
+                    improved = true;
+                }
+                if (improved) {
+                    publish_best_solution();
+                }
+            }
+            // an incomplete generation is discarded, its best individual has already been kept
+            if (interrupted) {
+                if (evolutionary_logger) {
+                    evolutionary_logger.AddLog(average_quality, best_solution.quality, EvolutionaryAlgorithmLogMessage::BudgetExhausted);
                 }
+                break;
             }
             // set the new generation as the current generation
             population = std::move(new_generation);
@@ -294,6 +621,354 @@ class MemeticAlgorithm
             if (evolutionary_logger) {
                 evolutionary_logger.AddLog(average_quality, best_solution.quality);
             }
+            end_generation();
+            if constexpr (checkpoints) {
+                if (checkpointer.Due()) {
+                    save_checkpoint();
+                }
+            }
+        }
+        // the last checkpoint is the state at the end of the last complete generation, from which the search can be resumed
+        if constexpr (checkpoints) {
+            save_checkpoint();
+            checkpointer.Flush();
+        }
+
+        // return the best solution found
+        auto best = encoder_decoder.template DecodeSolution<Solution>(best_solution.chromosome.begin(), best_solution.chromosome.end(), problem);
+        if (evolutionary_logger) {
+            evolutionary_logger.SetBestSolution(best);
+        }
+        return best;
+    }
+
+    /**
+     * @brief Finds a solution to a problem using a steady-state memetic algorithm. Instead of building a whole new generation,
+     * each step selects a couple, crosses, mutates and improves its offsprings, and the descendants chosen by the replacement
+     * operator take the places of the parents in the population. The population is a fixed array of individuals indexed by the
+     * hashes of their chromosomes, and its average quality is updated with each replacement, so no step traverses the population
+     * (besides the selection operator). The steps are grouped in generations of population_size / 2 couples, as many as in
+     * the generational algorithm, so the stopping criterion, the loggers and the checkpoints work as in FindSolution.
+     * 
+     * @param elitism if true the best individual of the population is never replaced.
+     * @see FindSolution for the rest of the parameters.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Checkpointer,
+              typename Problem,
+              typename EncoderDecoder,
+              typename GenerationOp,
+              typename SelectionOp,
+              typename CrossoverOp,
+              typename MutationOp,
+              typename ReplacementOp,
+              typename StoppingCriterion,
+              typename RNG,
+              typename LocalSearch,
+              typename LocalSearchPolicy,
+              typename... LocalSearchArgs>
+    static Solution FindSolutionSteadyState(EvolutionaryLogger<Solution>& evolutionary_logger,
+                                            LocalLogger<Solution>& local_logger,
+                                            SearchBudget& budget,
+                                            const ImprovementCallback& improvement_callback,
+                                            Checkpointer& checkpointer,
+                                            const Problem& problem,
+                                            const EncoderDecoder& encoder_decoder,
+                                            const GenerationOp& generation_op,
+                                            unsigned int population_size,
+                                            const SelectionOp& selection_op,
+                                            const CrossoverOp& crossover_op,
+                                            double cross_prob,
+                                            const MutationOp& mutation_op,
+                                            double mutation_prob,
+                                            const ReplacementOp& replacement_op,
+                                            bool elitism,
+                                            const StoppingCriterion& stopping_criterion,
+                                            RNG& rng,
+                                            const LocalSearch& local_search,
+                                            const LocalSearchPolicy& local_search_policy,
+                                            const LocalSearchArgs&... args)
+    {
+        using SolutionType = Solution;
+        using Couple = std::pair<std::reference_wrapper<const Individual>, std::reference_wrapper<const Individual>>;
+
+        constexpr bool checkpoints = !std::is_same<Checkpointer, IgnoreCheckpoints>::value;
+        LocalSearchPolicy policy = local_search_policy; // the policies can learn along the search
+        // state from which the search is resumed
+        EvolutionaryCheckpoint state;
+        bool resuming = false;
+        if constexpr (checkpoints) {
+            const auto instance = EvolutionaryCheckpoint::Fingerprint(problem);
+            resuming = checkpointer.Resume(state);
+            if (resuming) {
+                CheckCheckpoint(state, instance, problem, encoder_decoder, population_size);
+            }
+            state.instance = instance;
+        }
+
+        // create the initial population, the individuals never move from their places
+        std::vector<Individual> population;
+        if (resuming) {
+            for (auto& individual: state.population) {
+                population.push_back(Individual{std::move(individual.chromosome), individual.quality, individual.schedule});
+            }
+            budget.AddEvaluations(state.evaluations);
+            if constexpr (checkpoints) {
+                state.GetRNG(rng);
+            }
+        } else {
+            // each solution is encoded as soon as it is generated, so the encoding is also bounded by the budget
+            const auto encode = [&encoder_decoder](const SolutionType& solution) {
+                Individual individual;
+                encoder_decoder.EncodeSolution(std::back_inserter(individual.chromosome), solution);
+                individual.quality = solution.GetQuality();
+                individual.schedule = solution.GetHash();
+                return individual;
+            };
+            generation_op.template GetIndividuals<Solution>(
+                make_transform_output_iterator(std::back_inserter(population), encode), problem, population_size, rng, budget);
+        }
+        // places of the individuals indexed by the hashes of their chromosomes
+        std::unordered_multimap<std::size_t, std::size_t> places;
+        for (std::size_t i = 0; i < population.size(); i++) {
+            places.emplace(IndividualHash{}(population[i]), i);
+        }
+        const auto find = [&population, &places](const Individual& individual) -> const Individual* {
+            auto [first, last] = places.equal_range(IndividualHash{}(individual));
+            for (; first != last; ++first) {
+                if (population[first->second] == individual) {
+                    return &population[first->second];
+                }
+            }
+            return nullptr;
+        };
+        // sum of the qualities of the population, updated with each replacement with compensated (Neumaier) summation
+        // so that the rounding errors do not build up along the search
+        double total_quality = 0.0;
+        double compensation = 0.0;
+        const auto add_quality = [&total_quality, &compensation](double quality) {
+            double total = total_quality + quality;
+            compensation += std::fabs(total_quality) >= std::fabs(quality) ? (total_quality - total) + quality : (quality - total) + total_quality;
+            total_quality = total;
+        };
+        for (const auto& individual: population) {
+            add_quality(individual.quality);
+        }
+        // hashes of the schedules of the population
+        std::unordered_multiset<std::uint64_t> schedules;
+        for (const auto& individual: population) {
+            schedules.insert(individual.schedule);
+        }
+        const auto replace = [&population, &places, &schedules, &add_quality](std::size_t place, Individual individual) {
+            auto [first, last] = places.equal_range(IndividualHash{}(population[place]));
+            places.erase(std::find_if(first, last, [place](const auto& entry) { return entry.second == place; }));
+            places.emplace(IndividualHash{}(individual), place);
+            schedules.erase(schedules.find(population[place].schedule));
+            schedules.insert(individual.schedule);
+            add_quality(-population[place].quality);
+            add_quality(individual.quality);
+            population[place] = std::move(individual);
+        };
+
+        // random number generator
+        std::uniform_real_distribution<double> dis(0.0, 1.0);
+
+        // keep the best solution
+        Individual best_solution = resuming ? Individual{state.best.chromosome, state.best.quality, state.best.schedule}
+                                            : *std::max_element(population.begin(), population.end(), [](const auto& t1, const auto& t2) {
+                                                  return t1.quality < t2.quality;
+                                              });
+        // publish the best solution each time it improves
+        const auto publish_best_solution = [&]() {
+            if constexpr (!std::is_same<ImprovementCallback, IgnoreImprovements>::value) {
+                auto chromosome = best_solution.chromosome;
+                improvement_callback(encoder_decoder.template DecodeSolution<Solution>(chromosome.begin(), chromosome.end(), problem));
+            }
+        };
+        publish_best_solution();
+        // number of generations
+        unsigned int generations = resuming ? state.generations : 0;
+        // number of generations without improving
+        unsigned int no_improving_generations = resuming ? state.no_improving_generations : 0;
+        // average quality of the solutions
+        double average_quality = resuming ? state.average_quality : (total_quality + compensation) / population.size();
+        if (evolutionary_logger) {
+            evolutionary_logger.AddLog(average_quality, best_solution.quality);
+        }
+
+        // state at the end of the last complete generation, the population changes in place so it is copied
+        const auto end_generation = [&]() {
+            if constexpr (checkpoints) {
+                state.generations = generations;
+                state.no_improving_generations = no_improving_generations;
+                state.evaluations = budget.GetEvaluations();
+                state.average_quality = average_quality;
+                state.best = {best_solution.chromosome, best_solution.quality, best_solution.schedule};
+                state.SetRNG(rng);
+                state.population.clear();
+                // the sum of the qualities is also recalculated, so it does not depend on the history before the checkpoint
+                total_quality = 0.0;
+                compensation = 0.0;
+                for (const auto& individual: population) {
+                    state.population.push_back({individual.chromosome, individual.quality, individual.schedule});
+                    add_quality(individual.quality);
+                }
+            }
+        };
+        const auto save_checkpoint = [&]() {
+            if constexpr (checkpoints) {
+                checkpointer.Save(state);
+            }
+        };
+        end_generation();
+
+        while (!budget.Exhausted() &&
+               !stopping_criterion(generations++, no_improving_generations++, average_quality, best_solution.quality)) // termination criterion
+        {
+            bool interrupted = false; // true if the budget is exhausted in the middle of the generation
+            for (unsigned int step = 0; step < std::max(population_size / 2, 1U); step++) {
+                if (budget.ExhaustedNow()) {
+                    interrupted = true;
+                    break;
+                }
+                // select the couple that will reproduce
+                std::vector<Couple> couples;
+                selection_op.Select(population.begin(), population.end(), std::back_insert_iterator(couples), 1, rng);
+                const Individual& parent1 = couples.front().first;
+                const Individual& parent2 = couples.front().second;
+                std::size_t place1 = &parent1 - population.data();
+                std::size_t place2 = &parent2 - population.data();
+
+                // cross the individuals
+                Individual offspring1;
+                Individual offspring2;
+                if (dis(rng) < cross_prob) {
+                    crossover_op.Cross(parent1.chromosome.begin(),
+                                       parent1.chromosome.end(),
+                                       parent2.chromosome.begin(),
+                                       parent2.chromosome.end(),
+                                       std::back_inserter(offspring1.chromosome),
+                                       std::back_inserter(offspring2.chromosome),
+                                       rng);
+                } else {
+                    offspring1.chromosome = parent1.chromosome;
+                    offspring2.chromosome = parent2.chromosome;
+                }
+
+                // mutate the offsprings
+                if (dis(rng) < mutation_prob) {
+                    mutation_op.Mutate(offspring1.chromosome.begin(), offspring1.chromosome.end(), rng);
+                }
+                if (dis(rng) < mutation_prob) {
+                    mutation_op.Mutate(offspring2.chromosome.begin(), offspring2.chromosome.end(), rng);
+                }
+
+                // improve the offsprings
+                Improve(offspring1,
+                        parent1,
+                        parent2,
+                        LocalSearchLogMessage::RestartOffspring1,
+                        generations,
+                        local_logger,
+                        budget,
+                        problem,
+                        encoder_decoder,
+                        find,
+                        local_search,
+                        policy,
+                        rng,
+                        args...);
+                Improve(offspring2,
+                        parent1,
+                        parent2,
+                        LocalSearchLogMessage::RestartOffspring2,
+                        generations,
+                        local_logger,
+                        budget,
+                        problem,
+                        encoder_decoder,
+                        find,
+                        local_search,
+                        policy,
+                        rng,
+                        args...);
+
+                // the descendants take the places of the parents, without repeating the schedules of the rest of the population,
+                // and they are copied before because they can be the parents themselves
+                const auto [chosen1, chosen2] = Deduplicate(
+                    replacement_op.Choose(parent1, parent2, offspring1, offspring2, rng),
+                    parent1,
+                    parent2,
+                    offspring1,
+                    offspring2,
+                    [&](std::uint64_t schedule) {
+                        std::size_t replaced =
+                            (population[place1].schedule == schedule) + (place2 != place1 && population[place2].schedule == schedule);
+                        return schedules.count(schedule) > replaced;
+                    });
+                Individual descendant1 = chosen1;
+                Individual descendant2 = chosen2;
+
+                // check if any of the offsprings is the global best
+                bool improved = false;
+                for (const Individual* descendant: {&descendant1, &descendant2}) {
+                    if (descendant->quality > best_solution.quality) {
+                        best_solution = *descendant;
+                        no_improving_generations = 0;
+                        improved = true;
+                    }
+                }
+                if (improved) {
+                    publish_best_solution();
+                }
+
+                // with elitism the place of the best individual keeps it, and the worst descendant is dropped
+                if (elitism && !improved && descendant1 != best_solution && descendant2 != best_solution) {
+                    if (population[place1] == best_solution) {
+                        place1 = place2;
+                    }
+                    if (population[place2] == best_solution) {
+                        place2 = place1;
+                    }
+                    if (descendant1 < descendant2) {
+                        std::swap(descendant1, descendant2);
+                    }
+                }
+                replace(place1, std::move(descendant1));
+                if (place2 != place1) {
+                    replace(place2, std::move(descendant2));
+                }
+            }
+            // an incomplete generation is not part of the checkpoints, its best individual has already been kept
+            if (interrupted) {
+                if (evolutionary_logger) {
+                    evolutionary_logger.AddLog(average_quality, best_solution.quality, EvolutionaryAlgorithmLogMessage::BudgetExhausted);
+                }
+                break;
+            }
+            // update average quality
+            average_quality = (total_quality + compensation) / population.size();
+
+            if (evolutionary_logger) {
+                evolutionary_logger.AddLog(average_quality, best_solution.quality);
+            }
+            end_generation();
+            if constexpr (checkpoints) {
+                if (checkpointer.Due()) {
+                    save_checkpoint();
+                }
+            }
+        }
+        // the last checkpoint is the state at the end of the last complete generation, from which the search can be resumed
+        if constexpr (checkpoints) {
+            save_checkpoint();
+            checkpointer.Flush();
         }
 
         // return the best solution found
@@ -11,10 +11,17 @@
 #ifndef TABUSEARCHFIXEDLENGTH_HPP_
 #define TABUSEARCHFIXEDLENGTH_HPP_
 
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <metaheuristics/utils/estimate_telemetry.hpp>
 #include <metaheuristics/utils/local_search_logger.hpp>
 #include <metaheuristics/utils/move_data.hpp>
 #include <metaheuristics/utils/neighborhoods.hpp>
+#include <metaheuristics/utils/search_budget.hpp>
 #include <metaheuristics/utils/tabu_list.hpp>
+#include <utils/monotonic_arena.hpp>
 
 /**
  * @brief Provides static functions to do a tabu search with a fixed length tabu list.
@@ -25,12 +32,18 @@ class TabuSearchFixedLength
   public:
     /**
      * @brief Finds a solution to a problem using a tabu search metaheuristic with a fixed length tabu list.
+     * Besides the tabu moves, the moves that lead back to any of the last solutions (twice as many as the size of the tabu
+     * list) are skipped, which are recognized by their Zobrist hashes.
      * 
+     * @tparam Logger type of the logger, LocalSearchLogger or NullLocalSearchLogger.
      * @tparam Solution type of the solution to be evaluated.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
      * @tparam StoppingCriterion type of the stopping criterion to be used to terminate the algorithm.
      * @tparam Neighborhood type of the neighborhood to be used to find adjacent solutions.
      * @tparam Neighborhoods types of the additional neighborhoods to be used.
      * @param logger logger where a trace of the execution will be stored.
+     * @param budget budget that limits the resources that the search can consume.
+     * @param improvement_callback function to be called with each new best solution found.
      * @param initial_solution solution from where the search will start. 
      * @param tabu_list_size maximum size of the tabu list (the maximum number of moves to be remembered).
      * @param stopping_criterion stopping criterion to be used to terminate the algorithm.
@@ -38,8 +51,16 @@ class TabuSearchFixedLength
      * @param neighborhoods additional neighborhoods to be used to find adjacent solutions. 
      * @return the best solution found.
      */
-    template <typename Solution, typename StoppingCriterion, typename Neighborhood, typename... Neighborhoods>
-    static Solution FindSolution(LocalSearchLogger<Solution>& logger,
+    template <template <typename>
+              class Logger,
+              typename Solution,
+              typename ImprovementCallback,
+              typename StoppingCriterion,
+              typename Neighborhood,
+              typename... Neighborhoods>
+    static Solution FindSolution(Logger<Solution>& logger,
+                                 SearchBudget& budget,
+                                 const ImprovementCallback& improvement_callback,
                                  const Solution& initial_solution,
                                  unsigned int tabu_list_size,
                                  const StoppingCriterion& stopping_criterion,
@@ -48,31 +69,48 @@ class TabuSearchFixedLength
     {
         using SolutionType = Solution;
         using MoveType = typename Neighborhood::MoveType;
+        using MoveDataType = MoveData<MoveType, typename SolutionType::ObjectiveType>;
 
         if (logger) {
             logger.SetInitialSolution(initial_solution);
         }
         SolutionType current_solution = initial_solution; // the current solution
         SolutionType best_solution = current_solution; // the best found solution so far
+        improvement_callback(best_solution);
         TabuList<MoveType> tabu_list(tabu_list_size); // the tabu list
+        TabuList<std::uint64_t> visited(2 * tabu_list_size); // hashes of the last solutions, to avoid cycling back to them
+        visited.ForcePush(current_solution.GetHash());
 
         unsigned int iterations = 0; // number of iterations
         unsigned int no_improving_iterations = 0; // number of iterations without improving
+        MonotonicArena arena; // memory of the neighbors of an iteration, released at the start of the next one
 
-        while (!stopping_criterion(iterations++, no_improving_iterations++)) {
+        while (!budget.ExhaustedNow() && !stopping_criterion(iterations++, no_improving_iterations++)) {
             bool found_valid_neighbor = false;
-            std::vector<MoveData<MoveType>> moves;
-            GetNeighbors(std::inserter(moves, moves.begin()), current_solution, neighborhood, neighborhoods...);
-            std::sort(moves.begin(), moves.end(), std::greater<MoveData<MoveType>>());
+            arena.Reset();
+            std::pmr::vector<MoveDataType> moves(&arena);
+            GetNeighbors(std::inserter(moves, moves.begin()), current_solution, &arena, neighborhood, neighborhoods...);
+            budget.AddEvaluations(moves.size());
+            if constexpr ((Neighborhood::UsesEstimates() || ... || Neighborhoods::UsesEstimates())) {
+                EstimateTelemetry::Observe(current_solution, moves.begin(), moves.end());
+            }
+            std::sort(moves.begin(), moves.end()); // from the best to the worst estimate
             unsigned int neighbors_evaluated = 0; // logging variable
+            bool interrupted = false; // true if the budget is exhausted before a neighbor is chosen
             for (auto& move: moves) {
+                // the neighbors are evaluated exactly until one is chosen, which can take long in large instances
+                if (budget.Exhausted()) {
+                    interrupted = true;
+                    break;
+                }
                 neighbors_evaluated++;
-                if (move.quality_estimate > best_solution.GetQuality()) { // aspiration criterion
+                if (move.objective_estimate < best_solution.GetObjective()) { // aspiration criterion
                     SolutionType neighbor(current_solution);
                     neighbor.ApplyMove(move.move);
                     if (neighbor > best_solution) {
                         current_solution = neighbor;
                         best_solution = current_solution;
+                        improvement_callback(best_solution);
                         tabu_list.ForcePush(move.move.Invert());
                         no_improving_iterations = 0;
                         found_valid_neighbor = true;
@@ -82,22 +120,37 @@ class TabuSearchFixedLength
                 if (!tabu_list.Contains(move.move)) { // if the move is not tabu
                     // establish the neighbor as the current solution and update the tabu list
                     current_solution.ApplyMove(move.move);
+                    if (visited.Contains(current_solution.GetHash())) { // the move goes back to a recent solution
+                        // undo it with a copy, the moves are inverted in place and this one can still be chosen if all are tabu
+                        auto inverse = move.move;
+                        current_solution.ApplyMove(inverse.Invert());
+                        continue;
+                    }
                     tabu_list.ForcePush(move.move.Invert());
                     found_valid_neighbor = true;
                     break;
                 }
             }
+            if (interrupted) {
+                break;
+            }
             if (!found_valid_neighbor) { // if all moves are tabu choose the best neighbor
                 if (moves.empty()) {
-                    logger.AddLog(current_solution.GetQuality(), moves.size(), neighbors_evaluated, "No neighbors available");
+                    if (logger) {
+                        logger.AddLog(current_solution.GetQuality(), moves.size(), neighbors_evaluated, LocalSearchLogMessage::NoNeighbors);
+                    }
                     break;
                 }
-                auto move = *moves.begin();
+                auto& move = moves.front();
                 current_solution.ApplyMove(move.move);
                 tabu_list.ForcePush(move.move.Invert());
             }
+            visited.ForcePush(current_solution.GetHash());
             if (logger) {
-                logger.AddLog(current_solution.GetQuality(), moves.size(), neighbors_evaluated, !found_valid_neighbor ? "All moves tabu" : "");
+                logger.AddLog(current_solution.GetQuality(),
+                              moves.size(),
+                              neighbors_evaluated,
+                              !found_valid_neighbor ? LocalSearchLogMessage::AllMovesTabu : LocalSearchLogMessage::None);
             }
         }
         if (logger) {
@@ -0,0 +1,443 @@
+/**
+ * @file checkpoint.hpp
+ * @author Pablo
+ * @brief Checkpoints of the state of the evolutionary algorithms.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef CHECKPOINT_HPP_
+#define CHECKPOINT_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief State of an evolutionary algorithm at the end of a generation, enough to continue the search exactly where it was.
+ * The qualities of the individuals are stored along with their chromosomes, so they are not evaluated again
+ * (the population is also the cache of qualities of the algorithm).
+ * 
+ * In the binary format the checkpoint starts with the magic string "JSPCKPT" (with its terminating null character) and the
+ * version of the format (a 32-bit unsigned integer), followed by the fingerprint of the instance (the number of jobs, machines
+ * and tasks as 32-bit unsigned integers and the hash of its contents as a 64-bit unsigned integer) and the fields of the
+ * checkpoint. Each individual is stored
+ * as the length of its chromosome (a 32-bit unsigned integer), its genes, its quality and the hash of its schedule (a 64-bit
+ * unsigned integer). All the values use the native byte order.
+ * 
+ */
+struct EvolutionaryCheckpoint
+{
+    /**
+     * @brief Individual of the population.
+     * 
+     */
+    struct Individual
+    {
+        std::vector<unsigned int> chromosome; // the chromosome of the individual
+        double quality; // the quality (fitness) of the individual
+        std::uint64_t schedule = 0; // hash of the schedule of the individual, zero if unknown
+    };
+
+    /**
+     * @brief Fingerprint of the instance solved by the algorithm, a checkpoint can only be resumed for the same instance.
+     * 
+     */
+    struct InstanceFingerprint
+    {
+        std::uint32_t jobs = 0; // number of jobs
+        std::uint32_t machines = 0; // number of machines
+        std::uint32_t tasks = 0; // number of tasks
+        std::uint64_t hash = 0; // hash of the jobs and the tasks
+
+        bool operator==(const InstanceFingerprint& other) const
+        {
+            return jobs == other.jobs && machines == other.machines && tasks == other.tasks && hash == other.hash;
+        }
+
+        bool operator!=(const InstanceFingerprint& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    // version of the file format, the version 1 did not store the hashes of the schedules and the version 2 did not store
+    // the fingerprint of the instance
+    static constexpr std::uint32_t version = 3;
+
+    InstanceFingerprint instance; // fingerprint of the instance, all zeros if unknown
+
+    std::uint32_t generations = 0; // number of generations
+    std::uint32_t no_improving_generations = 0; // number of generations without improving
+    std::uint64_t evaluations = 0; // evaluations consumed from the budget
+    double average_quality = 0; // average quality of the population, as calculated by the algorithm
+    Individual best; // best individual found
+    std::vector<Individual> population; // individuals of the current generation
+    std::string rng; // state of the random number generator, as written by its operator<<
+
+    /**
+     * @brief Stores the state of a random number generator.
+     * 
+     * @tparam RNG type of the random number generator, it must be a RandomNumberEngine.
+     * @param generator random number generator.
+     */
+    template <typename RNG> void SetRNG(const RNG& generator)
+    {
+        std::ostringstream os;
+        os << generator;
+        rng = os.str();
+    }
+
+    /**
+     * @brief Restores the state of a random number generator.
+     * 
+     * @tparam RNG type of the random number generator, it must be a RandomNumberEngine.
+     * @param generator random number generator.
+     */
+    template <typename RNG> void GetRNG(RNG& generator) const
+    {
+        std::istringstream is(rng);
+        if (!(is >> generator)) {
+            throw std::invalid_argument("invalid state of the random number generator in the checkpoint");
+        }
+    }
+
+    /**
+     * @brief Calculates the fingerprint of an instance. The hash is the FNV-1a hash of the text representations of the jobs
+     * and the tasks, ordered by their identifiers.
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem to be solved.
+     * @return the fingerprint of the instance.
+     */
+    template <typename Problem> static InstanceFingerprint Fingerprint(const Problem& problem)
+    {
+        using JobType = typename Problem::JobType;
+        using TaskType = typename Problem::TaskType;
+
+        std::vector<std::reference_wrapper<const JobType>> jobs;
+        problem.GetJobs(std::back_inserter(jobs));
+        std::sort(jobs.begin(), jobs.end(), [](const JobType& j1, const JobType& j2) { return j1.GetJobID() < j2.GetJobID(); });
+        std::vector<std::reference_wrapper<const TaskType>> tasks;
+        problem.GetTasks(std::back_inserter(tasks));
+        std::sort(tasks.begin(), tasks.end(), [](const TaskType& t1, const TaskType& t2) { return t1.GetTaskID() < t2.GetTaskID(); });
+
+        std::ostringstream os;
+        os.precision(std::numeric_limits<double>::max_digits10);
+        for (const JobType& job: jobs) {
+            os << job;
+        }
+        for (const TaskType& task: tasks) {
+            os << task;
+        }
+
+        InstanceFingerprint fingerprint;
+        fingerprint.jobs = problem.GetNumberOfJobs();
+        fingerprint.machines = problem.GetNumberOfMachines();
+        fingerprint.tasks = problem.GetNumberOfTasks();
+        fingerprint.hash = 14695981039346656037ull;
+        for (unsigned char c: os.str()) {
+            fingerprint.hash = (fingerprint.hash ^ c) * 1099511628211ull;
+        }
+        return fingerprint;
+    }
+
+    /**
+     * @brief Writes the checkpoint in binary format.
+     * 
+     * @param os output stream, it must be opened in binary mode.
+     */
+    void Write(std::ostream& os) const
+    {
+        os.write("JSPCKPT", 8);
+        WriteValue(os, version);
+        WriteValue(os, instance.jobs);
+        WriteValue(os, instance.machines);
+        WriteValue(os, instance.tasks);
+        WriteValue(os, instance.hash);
+        WriteValue(os, generations);
+        WriteValue(os, no_improving_generations);
+        WriteValue(os, evaluations);
+        WriteValue(os, average_quality);
+        WriteIndividual(os, best);
+        WriteValue(os, static_cast<std::uint32_t>(population.size()));
+        for (const auto& individual: population) {
+            WriteIndividual(os, individual);
+        }
+        WriteValue(os, static_cast<std::uint32_t>(rng.size()));
+        os.write(rng.data(), rng.size());
+    }
+
+    /**
+     * @brief Reads a checkpoint in binary format.
+     * 
+     * @param is input stream, it must be opened in binary mode.
+     * @return the checkpoint.
+     */
+    static EvolutionaryCheckpoint Read(std::istream& is)
+    {
+        char magic[8];
+        is.read(magic, sizeof(magic));
+        if (!is || std::memcmp(magic, "JSPCKPT", 8) != 0) {
+            throw std::invalid_argument("not a checkpoint");
+        }
+        auto file_version = ReadValue<std::uint32_t>(is);
+        if (file_version == 0 || file_version > version) {
+            throw std::invalid_argument("unsupported version of the checkpoint");
+        }
+        EvolutionaryCheckpoint checkpoint;
+        if (file_version >= 3) {
+            checkpoint.instance.jobs = ReadValue<std::uint32_t>(is);
+            checkpoint.instance.machines = ReadValue<std::uint32_t>(is);
+            checkpoint.instance.tasks = ReadValue<std::uint32_t>(is);
+            checkpoint.instance.hash = ReadValue<std::uint64_t>(is);
+        }
+        checkpoint.generations = ReadValue<std::uint32_t>(is);
+        checkpoint.no_improving_generations = ReadValue<std::uint32_t>(is);
+        checkpoint.evaluations = ReadValue<std::uint64_t>(is);
+        checkpoint.average_quality = ReadValue<double>(is);
+        checkpoint.best = ReadIndividual(is, file_version);
+        // the sizes are not trusted, the individuals are read while the stream has data
+        auto population_size = ReadValue<std::uint32_t>(is);
+        for (std::uint32_t i = 0; i < population_size && is; i++) {
+            checkpoint.population.push_back(ReadIndividual(is, file_version));
+        }
+        auto rng_size = ReadValue<std::uint32_t>(is);
+        if (is && rng_size > max_rng_size) {
+            throw std::invalid_argument("invalid state of the random number generator in the checkpoint");
+        }
+        checkpoint.rng.resize(is ? rng_size : 0);
+        is.read(checkpoint.rng.data(), checkpoint.rng.size());
+        if (!is || checkpoint.population.empty()) {
+            throw std::invalid_argument("truncated checkpoint");
+        }
+        return checkpoint;
+    }
+
+  private:
+    static constexpr std::uint32_t max_rng_size = 1 << 20; // maximum length of the state of the random number generator
+
+    template <typename T> static void WriteValue(std::ostream& os, T value)
+    {
+        os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    template <typename T> static T ReadValue(std::istream& is)
+    {
+        T value{};
+        is.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+
+    static void WriteIndividual(std::ostream& os, const Individual& individual)
+    {
+        WriteValue(os, static_cast<std::uint32_t>(individual.chromosome.size()));
+        for (unsigned int gene: individual.chromosome) {
+            WriteValue(os, static_cast<std::uint32_t>(gene));
+        }
+        WriteValue(os, individual.quality);
+        WriteValue(os, individual.schedule);
+    }
+
+    static Individual ReadIndividual(std::istream& is, std::uint32_t file_version)
+    {
+        Individual individual;
+        auto length = ReadValue<std::uint32_t>(is);
+        for (std::uint32_t i = 0; i < length && is; i++) {
+            individual.chromosome.push_back(ReadValue<std::uint32_t>(is));
+        }
+        individual.quality = ReadValue<double>(is);
+        if (file_version >= 2) {
+            individual.schedule = ReadValue<std::uint64_t>(is);
+        }
+        return individual;
+    }
+};
+
+/**
+ * @brief Writes periodic checkpoints of an evolutionary algorithm to a file, and provides the last checkpoint of a previous
+ * execution to resume it. The checkpoints are handed to a background thread that writes them while the search goes on,
+ * so the search only waits if the previous checkpoint is still being written. Each checkpoint is written to a temporary
+ * file that then replaces the previous one, so the file always holds a complete checkpoint even if the process is killed.
+ * 
+ */
+class Checkpointer
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  private:
+    std::string path; // path of the checkpoint file
+    Clock::duration interval; // minimum wall-clock time between two checkpoints
+    Clock::time_point last; // instant of the last checkpoint
+    bool resume; // true while the checkpoint read at construction has not been taken
+    EvolutionaryCheckpoint checkpoint; // checkpoint read at construction, then the checkpoint being written
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool pending; // true while the checkpoint has to be written
+    bool failed; // true if a checkpoint could not be written
+    bool stop; // true once the background thread has to finish
+    std::thread writer; // background thread, constructed the last
+
+    /**
+     * @brief Body of the background thread, writes each checkpoint that is handed over.
+     * 
+     */
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [this]() { return pending || stop; });
+            if (!pending) {
+                return;
+            }
+            lock.unlock();
+            const std::string temporary = path + ".tmp";
+            bool written;
+            {
+                std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+                checkpoint.Write(file);
+                file.flush();
+                written = static_cast<bool>(file);
+            }
+            written = written && std::rename(temporary.c_str(), path.c_str()) == 0;
+            lock.lock();
+            failed = failed || !written;
+            pending = false;
+            condition.notify_all();
+        }
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return !pending; });
+        if (failed) {
+            throw std::invalid_argument("cannot write checkpoint " + path);
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs a new Checkpointer. If the file exists, its checkpoint is the state from which the search is resumed.
+     * 
+     * @param path path of the file where the checkpoints will be written.
+     * @param interval minimum wall-clock time between two checkpoints, zero to write one each generation.
+     */
+    explicit Checkpointer(std::string path, Clock::duration interval = std::chrono::minutes(1)) :
+        path{std::move(path)},
+        interval{interval},
+        last{Clock::now()},
+        resume{false},
+        pending{false},
+        failed{false},
+        stop{false}
+    {
+        std::ifstream file(this->path, std::ios::binary);
+        if (file) {
+            checkpoint = EvolutionaryCheckpoint::Read(file);
+            resume = true;
+        }
+        writer = std::thread(&Checkpointer::Run, this);
+    }
+
+    Checkpointer(const Checkpointer&) = delete;
+    Checkpointer& operator=(const Checkpointer&) = delete;
+
+    /**
+     * @brief Destroys the Checkpointer, the pending checkpoint is written before.
+     * 
+     */
+    ~Checkpointer()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return !pending; });
+            stop = true;
+        }
+        condition.notify_all();
+        writer.join();
+    }
+
+    /**
+     * @brief Takes the checkpoint from which the search has to be resumed, if any. It can only be taken once.
+     * 
+     * @param state where the checkpoint is stored.
+     * @return true if there was a checkpoint to resume from.
+     */
+    bool Resume(EvolutionaryCheckpoint& state)
+    {
+        if (!resume) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        state = std::move(checkpoint);
+        resume = false;
+        return true;
+    }
+
+    /**
+     * @brief Checks if the interval since the last checkpoint has elapsed.
+     * 
+     * @return true if a new checkpoint has to be written.
+     */
+    bool Due() const
+    {
+        return Clock::now() - last >= interval;
+    }
+
+    /**
+     * @brief Hands a checkpoint to the background thread, waiting for it to finish with the previous one.
+     * 
+     * @param state checkpoint to be written.
+     */
+    void Save(EvolutionaryCheckpoint state)
+    {
+        Wait();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            checkpoint = std::move(state);
+            pending = true;
+            resume = false;
+        }
+        condition.notify_all();
+        last = Clock::now();
+    }
+
+    /**
+     * @brief Waits until the last checkpoint has been written.
+     * 
+     */
+    void Flush()
+    {
+        Wait();
+    }
+};
+
+/**
+ * @brief Checkpointer that does not write checkpoints, the algorithms skip all the work related to checkpoints.
+ * 
+ */
+struct IgnoreCheckpoints
+{
+};
+
+#endif /* CHECKPOINT_HPP_ */
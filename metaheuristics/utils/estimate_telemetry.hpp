@@ -0,0 +1,356 @@
+/**
+ * @file estimate_telemetry.hpp
+ * @author Pablo
+ * @brief Measurement of the accuracy of the estimated objectives of the neighbors.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ESTIMATETELEMETRY_HPP_
+#define ESTIMATETELEMETRY_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <utils/philox.hpp>
+
+/**
+ * @brief Collects how accurate the estimated objectives of the neighbors of a local search are. At each iteration where it
+ * is active, a sample of the candidate moves is evaluated exactly and compared with the estimates:
+ * - the error of each estimate, relative to the objective of the current solution (positive when the move is overestimated),
+ * - the Spearman rank correlation between the estimates and the exact objectives of the sample,
+ * - the fraction of pairs of moves of the sample that the estimates rank in the opposite order,
+ * - how often the move with the best estimate of the sample is also the best one.
+ * 
+ * The telemetry is active in a thread while a Scope is alive, and the local searches call Observe at each iteration, which
+ * does nothing when there is not an active telemetry. The exact evaluations do not consume the budget of the search, and
+ * they use their own random number generator, so the search follows the same trajectory with and without telemetry.
+ * 
+ */
+class EstimateTelemetry
+{
+  private:
+    unsigned int samples_per_iteration; // moves evaluated exactly at each iteration
+    Philox4x32 rng; // random number generator of the samples
+    unsigned long long iterations = 0; // iterations observed
+    unsigned long long neighbors = 0; // moves of the observed iterations
+    std::vector<double> errors; // relative errors of the estimates
+    unsigned long long exact = 0; // estimates equal to the exact objective
+    unsigned long long underestimates = 0; // estimates lower than the exact objective
+    double correlation = 0; // sum of the rank correlations of the iterations
+    unsigned long long correlated_iterations = 0; // iterations whose rank correlation is defined
+    unsigned long long misranked_pairs = 0; // pairs of moves ranked in the opposite order by the estimates
+    unsigned long long ranked_pairs = 0; // pairs of moves with different estimates and exact objectives
+    unsigned long long top_hits = 0; // iterations where the best estimated move of the sample is the best one
+    unsigned long long top_iterations = 0; // iterations with at least two samples
+    std::chrono::steady_clock::duration sampling_time{}; // time spent sampling, most of it in the exact evaluations
+
+    static EstimateTelemetry*& Active()
+    {
+        thread_local EstimateTelemetry* active = nullptr;
+        return active;
+    }
+
+    /**
+     * @brief Returns the ranks of some values, the tied values get the average of their ranks.
+     * 
+     * @param values values to be ranked.
+     * @return the rank of each value.
+     */
+    static std::vector<double> Ranks(const std::vector<double>& values)
+    {
+        std::vector<std::size_t> order(values.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&values](std::size_t a, std::size_t b) { return values[a] < values[b]; });
+        std::vector<double> ranks(values.size());
+        for (std::size_t i = 0; i < order.size();) {
+            std::size_t j = i;
+            while (j < order.size() && values[order[j]] == values[order[i]]) {
+                j++;
+            }
+            for (std::size_t k = i; k < j; k++) {
+                ranks[order[k]] = (i + j - 1) / 2.0;
+            }
+            i = j;
+        }
+        return ranks;
+    }
+
+    /**
+     * @brief Records the estimated and exact objectives of the sample of an iteration.
+     * 
+     * @param estimates estimated objectives.
+     * @param exacts exact objectives.
+     * @param current objective of the current solution.
+     */
+    void Record(const std::vector<double>& estimates, const std::vector<double>& exacts, double current)
+    {
+        const std::size_t n = estimates.size();
+        for (std::size_t i = 0; i < n; i++) {
+            errors.push_back(current != 0 ? (estimates[i] - exacts[i]) / std::abs(current) : estimates[i] - exacts[i]);
+            exact += estimates[i] == exacts[i];
+            underestimates += estimates[i] < exacts[i];
+            for (std::size_t j = i + 1; j < n; j++) {
+                if (estimates[i] != estimates[j] && exacts[i] != exacts[j]) {
+                    ranked_pairs++;
+                    misranked_pairs += (estimates[i] < estimates[j]) != (exacts[i] < exacts[j]);
+                }
+            }
+        }
+        if (n < 2) {
+            return;
+        }
+        top_iterations++;
+        std::size_t best = std::min_element(estimates.begin(), estimates.end()) - estimates.begin();
+        top_hits += exacts[best] == *std::min_element(exacts.begin(), exacts.end());
+
+        auto estimate_ranks = Ranks(estimates);
+        auto exact_ranks = Ranks(exacts);
+        double mean = (n - 1) / 2.0;
+        double covariance = 0;
+        double estimate_variance = 0;
+        double exact_variance = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            covariance += (estimate_ranks[i] - mean) * (exact_ranks[i] - mean);
+            estimate_variance += (estimate_ranks[i] - mean) * (estimate_ranks[i] - mean);
+            exact_variance += (exact_ranks[i] - mean) * (exact_ranks[i] - mean);
+        }
+        if (estimate_variance > 0 && exact_variance > 0) {
+            correlation += covariance / std::sqrt(estimate_variance * exact_variance);
+            correlated_iterations++;
+        }
+    }
+
+  public:
+    /**
+     * @brief Activates a telemetry in the current thread while it is alive.
+     * 
+     */
+    class Scope
+    {
+      private:
+        EstimateTelemetry* previous; // telemetry that was active before
+
+      public:
+        /**
+         * @brief Constructs a new Scope.
+         * 
+         * @param telemetry telemetry to be activated.
+         */
+        explicit Scope(EstimateTelemetry& telemetry) : previous{Active()}
+        {
+            Active() = &telemetry;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope()
+        {
+            Active() = previous;
+        }
+    };
+
+    /**
+     * @brief Constructs a new EstimateTelemetry.
+     * 
+     * @param samples_per_iteration moves evaluated exactly at each iteration, all of them if there are fewer.
+     * @param seed seed of the random number generator of the samples.
+     */
+    explicit EstimateTelemetry(unsigned int samples_per_iteration = 16, std::uint64_t seed = 0) :
+        samples_per_iteration{samples_per_iteration},
+        rng{seed}
+    {}
+
+    /**
+     * @brief Samples the moves of an iteration of a local search and compares their estimated objectives with the exact ones,
+     * if there is an active telemetry in the current thread.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam Iter type of the iterator to be used to read the moves, which point to MoveData.
+     * @param solution current solution of the search.
+     * @param first iterator pointing to the first move.
+     * @param last iterator pointing to the move past the last move.
+     */
+    template <typename Solution, typename Iter> static void Observe(const Solution& solution, Iter first, Iter last)
+    {
+        EstimateTelemetry* telemetry = Active();
+        if (telemetry != nullptr) {
+            telemetry->Sample(solution, first, last);
+        }
+    }
+
+    /**
+     * @brief Samples the moves of an iteration and compares their estimated objectives with the exact ones.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam Iter type of the iterator to be used to read the moves, which point to MoveData.
+     * @param solution solution whose neighbors are the moves.
+     * @param first iterator pointing to the first move.
+     * @param last iterator pointing to the move past the last move.
+     */
+    template <typename Solution, typename Iter> void Sample(const Solution& solution, Iter first, Iter last)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const std::size_t size = std::distance(first, last);
+        iterations++;
+        neighbors += size;
+        const std::size_t n = std::min<std::size_t>(samples_per_iteration, size);
+        if (n == 0) {
+            return;
+        }
+        // partial shuffle of the moves, the first n are the sample
+        std::vector<std::size_t> indices(size);
+        std::iota(indices.begin(), indices.end(), 0);
+        for (std::size_t i = 0; i < n; i++) {
+            std::uniform_int_distribution<std::size_t> dis(i, size - 1);
+            std::swap(indices[i], indices[dis(rng)]);
+        }
+
+        Solution copy(solution);
+        std::vector<double> estimates;
+        std::vector<double> exacts;
+        for (std::size_t i = 0; i < n; i++) {
+            const auto& move_data = *std::next(first, indices[i]);
+            auto move = move_data.move;
+            copy.ApplyMove(move);
+            exacts.push_back(static_cast<double>(copy.GetObjective()));
+            copy.ApplyMove(move.Invert());
+            estimates.push_back(static_cast<double>(move_data.objective_estimate));
+        }
+        Record(estimates, exacts, static_cast<double>(solution.GetObjective()));
+        sampling_time += std::chrono::steady_clock::now() - start;
+    }
+
+    /**
+     * @brief Returns the number of iterations observed.
+     * 
+     * @return the number of iterations observed.
+     */
+    unsigned long long GetIterations() const
+    {
+        return iterations;
+    }
+
+    /**
+     * @brief Returns the average number of moves of the observed iterations.
+     * 
+     * @return the average number of moves of the observed iterations.
+     */
+    double GetNeighborsPerIteration() const
+    {
+        return iterations > 0 ? static_cast<double>(neighbors) / iterations : 0;
+    }
+
+    /**
+     * @brief Returns the number of moves evaluated exactly.
+     * 
+     * @return the number of moves evaluated exactly.
+     */
+    std::size_t GetSamples() const
+    {
+        return errors.size();
+    }
+
+    /**
+     * @brief Returns the fraction of the estimates that are exact.
+     * 
+     * @return the fraction of the estimates that are exact.
+     */
+    double GetExactFraction() const
+    {
+        return errors.empty() ? 0 : static_cast<double>(exact) / errors.size();
+    }
+
+    /**
+     * @brief Returns the fraction of the estimates that are lower than the exact objective.
+     * 
+     * @return the fraction of the estimates that are lower than the exact objective.
+     */
+    double GetUnderestimateFraction() const
+    {
+        return errors.empty() ? 0 : static_cast<double>(underestimates) / errors.size();
+    }
+
+    /**
+     * @brief Returns the mean of the absolute relative errors.
+     * 
+     * @return the mean of the absolute relative errors.
+     */
+    double GetMeanAbsoluteError() const
+    {
+        if (errors.empty()) {
+            return 0;
+        }
+        return std::accumulate(errors.begin(), errors.end(), 0.0, [](double sum, double error) { return sum + std::abs(error); }) / errors.size();
+    }
+
+    /**
+     * @brief Returns a percentile of the relative errors.
+     * 
+     * @param percentile percentile, between 0 and 1.
+     * @return the percentile of the relative errors.
+     */
+    double GetErrorPercentile(double percentile) const
+    {
+        if (errors.empty()) {
+            return 0;
+        }
+        std::vector<double> sorted(errors);
+        std::size_t k = std::min(sorted.size() - 1, static_cast<std::size_t>(percentile * sorted.size()));
+        std::nth_element(sorted.begin(), sorted.begin() + k, sorted.end());
+        return sorted[k];
+    }
+
+    /**
+     * @brief Returns the mean of the Spearman rank correlations of the samples of the iterations.
+     * 
+     * @return the mean rank correlation, 0 if it is not defined in any iteration.
+     */
+    double GetRankCorrelation() const
+    {
+        return correlated_iterations > 0 ? correlation / correlated_iterations : 0;
+    }
+
+    /**
+     * @brief Returns the fraction of the pairs of moves that the estimates rank in the opposite order.
+     * 
+     * @return the fraction of the pairs of moves that the estimates rank in the opposite order.
+     */
+    double GetMisrankedFraction() const
+    {
+        return ranked_pairs > 0 ? static_cast<double>(misranked_pairs) / ranked_pairs : 0;
+    }
+
+    /**
+     * @brief Returns the fraction of the iterations where the move with the best estimate of the sample is the best one.
+     * 
+     * @return the fraction of the iterations where the move with the best estimate of the sample is the best one.
+     */
+    double GetTopAgreement() const
+    {
+        return top_iterations > 0 ? static_cast<double>(top_hits) / top_iterations : 0;
+    }
+
+    /**
+     * @brief Returns the time spent sampling, most of it in the exact evaluations.
+     * 
+     * @return the time spent sampling.
+     */
+    std::chrono::steady_clock::duration GetTime() const
+    {
+        return sampling_time;
+    }
+};
+
+#endif /* ESTIMATETELEMETRY_HPP_ */
@@ -11,11 +11,25 @@
 #ifndef EVOLUTIONARYALGORITHMLOGGER_HPP_
 #define EVOLUTIONARYALGORITHMLOGGER_HPP_
 
+#include <algorithm>
+#include <optional>
+#include <ostream>
 #include <string>
 #include <vector>
 
 /**
- * @brief Logger to trace the execution of an evolutionary algorithm.
+ * @brief Messages that can be attached to the logs of an evolutionary algorithm.
+ * 
+ */
+enum class EvolutionaryAlgorithmLogMessage : unsigned char
+{
+    None, // no message
+    BudgetExhausted // the budget was exhausted in the middle of the generation
+};
+
+/**
+ * @brief Logger to trace the execution of an evolutionary algorithm. The logs are kept
+ * in a ring buffer of fixed size, so only the most recent logs are stored.
  * 
  * @tparam Solution type of the solutions to be logged.
  */
@@ -32,7 +46,9 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
     {
         double average_quality; // average quality of the solutions
         double maximum_quality; // maximum quality of the solutions
-        std::string msg; // optional message
+        EvolutionaryAlgorithmLogMessage msg; // optional message
+
+        Log() = default;
 
         /**
          * @brief Constructs a new Log.
@@ -41,15 +57,19 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
          * @param maximum_quality maximum quality of the solutions.
          * @param msg optional message.
          */
-        Log(double average_quality, double maximum_quality, std::string msg = "") :
+        Log(double average_quality, double maximum_quality, EvolutionaryAlgorithmLogMessage msg = EvolutionaryAlgorithmLogMessage::None) :
             average_quality{average_quality},
             maximum_quality{maximum_quality},
             msg{msg} {};
 
         friend std::ostream& operator<<(std::ostream& os, const Log& log)
         {
-            if (log.msg != "") {
-                os << log.msg << std::endl;
+            switch (log.msg) {
+            case EvolutionaryAlgorithmLogMessage::None:
+                break;
+            case EvolutionaryAlgorithmLogMessage::BudgetExhausted:
+                os << "Budget exhausted" << std::endl;
+                break;
             }
             return os << "Average quality = " << log.average_quality << std::endl << "Maximum quality = " << log.maximum_quality << std::endl;
         }
@@ -57,7 +77,9 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
 
   private:
     std::string id;
-    std::vector<Log> history;
+    std::vector<Log> history; // ring buffer with the most recent logs
+    std::size_t next; // position of the ring buffer where the next log will be stored
+    std::size_t logged; // number of logs added since the creation of the logger
     std::optional<SolutionType> best_solution;
     bool active;
 
@@ -67,8 +89,14 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
      * 
      * @param id identifier of the logger.
      * @param active if true the logger will log the algorithm trace, if false the logger won't log the algorithm trace.
+     * @param capacity maximum number of logs to be stored, when full the oldest logs are overwritten.
      */
-    EvolutionaryAlgorithmLogger(std::string id, bool active = false) : id{id}, active{active} {};
+    EvolutionaryAlgorithmLogger(std::string id, bool active = false, std::size_t capacity = 1 << 14) :
+        id{id},
+        history(active ? capacity : 0),
+        next{0},
+        logged{0},
+        active{active} {};
 
     /**
      * @brief Sets the best solution found by the algorithm.
@@ -83,7 +111,7 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
     /**
      * @brief Returns the best solution found by the algorithm.
      * 
-     * @return the best solution found by the algorithm. 
+     * @return the best solution found by the algorithm.
      */
     SolutionType GetBestSolution()
     {
@@ -97,27 +125,35 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
      * @param maximum_quality maximum quality of the solutions.
      * @param msg optional message.
      */
-    void AddLog(double average_quality, double maximum_quality, std::string msg = "")
+    void AddLog(double average_quality, double maximum_quality, EvolutionaryAlgorithmLogMessage msg = EvolutionaryAlgorithmLogMessage::None)
     {
-        history.emplace_back(average_quality, maximum_quality, msg);
+        if (history.empty()) {
+            return;
+        }
+        history[next] = Log(average_quality, maximum_quality, msg);
+        next = next + 1 == history.size() ? 0 : next + 1;
+        logged++;
     }
 
     /**
-     * @brief Inserts in a container all the logged iterations.
+     * @brief Inserts in a container the stored logs, from the oldest to the most recent.
      * 
      * @tparam Iter type of the iterator to be used to insert the logs.
      * @param dest iterator to be used to insert the logs.
-     * @return an iterator to the log past the last log inserted. 
+     * @return an iterator to the log past the last log inserted.
      */
-    template <typename Iter> Iter GetHistory(Iter dest)
+    template <typename Iter> Iter GetHistory(Iter dest) const
     {
-        return std::copy(history.begin(), history.end(), dest);
+        if (logged > history.size()) {
+            dest = std::copy(history.begin() + next, history.end(), dest);
+        }
+        return std::copy(history.begin(), history.begin() + next, dest);
     }
 
     /**
      * @brief Returns if the logger is active or not.
      * 
-     * @return true if the logger is active. 
+     * @return true if the logger is active.
      * @return false if the logger is inactive.
      */
     explicit operator bool() const
@@ -128,8 +164,10 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
     friend std::ostream& operator<<(std::ostream& os, const EvolutionaryAlgorithmLogger& logger)
     {
         if (logger.active) {
-            std::size_t i = 0;
-            for (const auto& log: logger.history) {
+            std::vector<Log> logs;
+            logger.GetHistory(std::back_inserter(logs));
+            std::size_t i = logger.logged - logs.size();
+            for (const auto& log: logs) {
                 os << "Iteration " << i++ << std::endl << log;
             }
             os << "Best solution found" << std::endl << (logger.best_solution.has_value() ? logger.best_solution->ToString() : "");
@@ -140,4 +178,34 @@ template <typename Solution> class EvolutionaryAlgorithmLogger
     }
 };
 
+/**
+ * @brief Logger that discards all the logs. The calls to this logger are removed by the compiler.
+ * 
+ * @tparam Solution type of the solutions to be logged.
+ */
+template <typename Solution> class NullEvolutionaryAlgorithmLogger
+{
+  public:
+    using SolutionType = Solution;
+
+    void SetBestSolution(const SolutionType&) {}
+
+    void AddLog(double, double, EvolutionaryAlgorithmLogMessage = EvolutionaryAlgorithmLogMessage::None) {}
+
+    template <typename Iter> Iter GetHistory(Iter dest) const
+    {
+        return dest;
+    }
+
+    constexpr explicit operator bool() const
+    {
+        return false;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const NullEvolutionaryAlgorithmLogger&)
+    {
+        return os;
+    }
+};
+
 #endif /* EVOLUTIONARYALGORITHMLOGGER_HPP_ */
\ No newline at end of file
@@ -11,11 +11,28 @@
 #ifndef LOCALSEARCHLOGGER_HPP_
 #define LOCALSEARCHLOGGER_HPP_
 
+#include <algorithm>
+#include <optional>
+#include <ostream>
 #include <string>
 #include <vector>
 
 /**
- * @brief Logger to trace the evolution of a local search algorithm.
+ * @brief Messages that can be attached to the logs of a local search algorithm.
+ * 
+ */
+enum class LocalSearchLogMessage : unsigned char
+{
+    None, // no message
+    AllMovesTabu, // all the moves were tabu
+    NoNeighbors, // no neighbors available
+    RestartOffspring1, // restart from the first offspring of a generation
+    RestartOffspring2 // restart from the second offspring of a generation
+};
+
+/**
+ * @brief Logger to trace the evolution of a local search algorithm. The logs are kept
+ * in a ring buffer of fixed size, so only the most recent logs are stored.
  * 
  * @tparam Solution type of the solutions to be logged.
  */
@@ -33,7 +50,10 @@ template <typename Solution> class LocalSearchLogger
         double quality; // quality of the selected solution
         unsigned int neighbors_generated; // neighbors generated in the iteration
         unsigned int neighbors_evaluated; // neighbors evaluated in the iteration
-        std::string msg; // optional message
+        unsigned int value; // value attached to the message
+        LocalSearchLogMessage msg; // optional message
+
+        Log() = default;
 
         /**
          * @brief Constructs a new Log.
@@ -42,17 +62,36 @@ template <typename Solution> class LocalSearchLogger
          * @param neighbors_generated neighbors generated in the iteration.
          * @param neighbors_evaluated neighbors evaluated in the iteration.
          * @param msg optional message.
+         * @param value value attached to the message.
          */
-        Log(double quality, unsigned int neighbors_generated, unsigned int neighbors_evaluated, std::string msg = "") :
+        Log(double quality,
+            unsigned int neighbors_generated,
+            unsigned int neighbors_evaluated,
+            LocalSearchLogMessage msg = LocalSearchLogMessage::None,
+            unsigned int value = 0) :
             quality{quality},
             neighbors_generated{neighbors_generated},
             neighbors_evaluated{neighbors_evaluated},
+            value{value},
             msg{msg} {};
 
         friend std::ostream& operator<<(std::ostream& os, const Log& log)
         {
-            if (log.msg != "") {
-                os << log.msg << std::endl;
+            switch (log.msg) {
+            case LocalSearchLogMessage::None:
+                break;
+            case LocalSearchLogMessage::AllMovesTabu:
+                os << "All moves tabu" << std::endl;
+                break;
+            case LocalSearchLogMessage::NoNeighbors:
+                os << "No neighbors available" << std::endl;
+                break;
+            case LocalSearchLogMessage::RestartOffspring1:
+                os << "Restart solution. Offspring1. Iteration: " << log.value << std::endl;
+                break;
+            case LocalSearchLogMessage::RestartOffspring2:
+                os << "Restart solution. Offspring2. Iteration: " << log.value << std::endl;
+                break;
             }
             return os << "Neighbors generated = " << log.neighbors_generated << std::endl
                       << "Neighbors evaluated = " << log.neighbors_evaluated << std::endl
@@ -62,7 +101,9 @@ template <typename Solution> class LocalSearchLogger
 
   private:
     std::string id;
-    std::vector<Log> history;
+    std::vector<Log> history; // ring buffer with the most recent logs
+    std::size_t next; // position of the ring buffer where the next log will be stored
+    std::size_t logged; // number of logs added since the creation of the logger
     std::optional<SolutionType> initial_solution;
     std::optional<SolutionType> best_solution;
     bool active;
@@ -73,8 +114,14 @@ template <typename Solution> class LocalSearchLogger
      * 
      * @param id identifier of the logger.
      * @param active if true the logger will log the algorithm trace, if false the logger won't log the algorithm trace.
+     * @param capacity maximum number of logs to be stored, when full the oldest logs are overwritten.
      */
-    LocalSearchLogger(std::string id, bool active = false) : id{id}, active{active} {};
+    LocalSearchLogger(std::string id, bool active = false, std::size_t capacity = 1 << 14) :
+        id{id},
+        history(active ? capacity : 0),
+        next{0},
+        logged{0},
+        active{active} {};
 
     /**
      * @brief Sets the initial solution.
@@ -109,7 +156,7 @@ template <typename Solution> class LocalSearchLogger
     /**
      * @brief Returns the best solution found by the algorithm.
      * 
-     * @return the best solution found by the algorithm. 
+     * @return the best solution found by the algorithm.
      */
     SolutionType GetBestSolution()
     {
@@ -123,28 +170,41 @@ template <typename Solution> class LocalSearchLogger
      * @param neighbors_generated neighbors generated in the iteration.
      * @param neighbors_evaluated neighbors evaluated in the iteration.
      * @param msg optional message.
+     * @param value value attached to the message.
      */
-    void AddLog(double quality, unsigned int neighbors_generated, unsigned int neighbors_evaluated, std::string msg = "")
+    void AddLog(double quality,
+                unsigned int neighbors_generated,
+                unsigned int neighbors_evaluated,
+                LocalSearchLogMessage msg = LocalSearchLogMessage::None,
+                unsigned int value = 0)
     {
-        history.emplace_back(quality, neighbors_generated, neighbors_evaluated, msg);
+        if (history.empty()) {
+            return;
+        }
+        history[next] = Log(quality, neighbors_generated, neighbors_evaluated, msg, value);
+        next = next + 1 == history.size() ? 0 : next + 1;
+        logged++;
     }
 
     /**
-     * @brief Inserts in a container all the logged iterations.
+     * @brief Inserts in a container the stored logs, from the oldest to the most recent.
      * 
      * @tparam Iter type of the iterator to be used to insert the logs.
      * @param dest iterator to be used to insert the logs.
-     * @return an iterator to the log past the last log inserted. 
+     * @return an iterator to the log past the last log inserted.
      */
-    template <typename Iter> Iter GetHistory(Iter dest)
+    template <typename Iter> Iter GetHistory(Iter dest) const
     {
-        return std::copy(history.begin(), history.end(), dest);
+        if (logged > history.size()) {
+            dest = std::copy(history.begin() + next, history.end(), dest);
+        }
+        return std::copy(history.begin(), history.begin() + next, dest);
     }
 
     /**
      * @brief Returns if the logger is active or not.
      * 
-     * @return true if the logger is active. 
+     * @return true if the logger is active.
      * @return false if the logger is inactive.
      */
     explicit operator bool() const
@@ -156,8 +216,10 @@ template <typename Solution> class LocalSearchLogger
     {
         if (logger.active) {
             os << "Initial solution" << std::endl << (logger.initial_solution.has_value() ? logger.initial_solution->ToString() : "");
-            std::size_t i = 0;
-            for (const auto& log: logger.history) {
+            std::vector<Log> logs;
+            logger.GetHistory(std::back_inserter(logs));
+            std::size_t i = logger.logged - logs.size();
+            for (const auto& log: logs) {
                 os << "Iteration " << i++ << std::endl << log;
             }
             os << "Best solution found" << std::endl << (logger.best_solution.has_value() ? logger.best_solution->ToString() : "");
@@ -168,4 +230,36 @@ template <typename Solution> class LocalSearchLogger
     }
 };
 
+/**
+ * @brief Logger that discards all the logs. The calls to this logger are removed by the compiler.
+ * 
+ * @tparam Solution type of the solutions to be logged.
+ */
+template <typename Solution> class NullLocalSearchLogger
+{
+  public:
+    using SolutionType = Solution;
+
+    void SetInitialSolution(const SolutionType&) {}
+
+    void SetBestSolution(const SolutionType&) {}
+
+    void AddLog(double, unsigned int, unsigned int, LocalSearchLogMessage = LocalSearchLogMessage::None, unsigned int = 0) {}
+
+    template <typename Iter> Iter GetHistory(Iter dest) const
+    {
+        return dest;
+    }
+
+    constexpr explicit operator bool() const
+    {
+        return false;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const NullLocalSearchLogger&)
+    {
+        return os;
+    }
+};
+
 #endif /* LOCALSEARCHLOGGER_HPP_ */
\ No newline at end of file
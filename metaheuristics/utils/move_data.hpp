@@ -11,55 +11,68 @@
 #ifndef MOVEDATA_HPP_
 #define MOVEDATA_HPP_
 
+#include <utility>
+
 /**
- * @brief Auxiliary class that is used to pass a candidate move along with its estimated quality to the local search algorithms.
+ * @brief Auxiliary class that is used to pass a candidate move along with its estimated objective to the local search algorithms.
+ * The moves are ordered from the best to the worst estimate, that is, from the lowest to the highest objective.
  * 
  * @tparam Move type of the move.
+ * @tparam Objective type of the key that ranks the solutions (see the method GetObjective of the solutions).
  */
-template <typename Move> struct MoveData
+template <typename Move, typename Objective> struct MoveData
 {
     using MoveType = Move;
+    using ObjectiveType = Objective;
 
     MoveType move; // move that leads to a neighboring solution
-    double quality_estimate; // estimate of the quality of the neighboring solution
+    ObjectiveType objective_estimate; // estimate of the objective of the neighboring solution
 
     /**
      * @brief Constructs a new MoveData.
      * 
      * @param move move that leads to a neighboring solution.
-     * @param quality_estimate estimate of the quality of the neighboring solution. 
+     * @param objective_estimate estimate of the objective of the neighboring solution.
+     */
+    MoveData(const MoveType& move, const ObjectiveType& objective_estimate) : move{move}, objective_estimate{objective_estimate} {};
+
+    /**
+     * @brief Constructs a new MoveData that takes the move, which keeps its allocator.
+     * 
+     * @param move move that leads to a neighboring solution.
+     * @param objective_estimate estimate of the objective of the neighboring solution.
      */
-    MoveData(const MoveType& move, double quality_estimate) : move{move}, quality_estimate{quality_estimate} {};
+    MoveData(MoveType&& move, const ObjectiveType& objective_estimate) : move{std::move(move)}, objective_estimate{objective_estimate} {};
 
     bool operator==(const MoveData& other) const
     {
-        return move == other.move && quality_estimate == other.quality_estimate;
+        return move == other.move && objective_estimate == other.objective_estimate;
     };
 
     bool operator!=(const MoveData& other) const
     {
-        return move != other.move || quality_estimate != other.quality_estimate;
+        return move != other.move || objective_estimate != other.objective_estimate;
     };
 
     bool operator<(const MoveData& other) const
     {
-        return quality_estimate < other.quality_estimate;
+        return objective_estimate < other.objective_estimate;
     };
 
     bool operator>(const MoveData& other) const
     {
-        return quality_estimate > other.quality_estimate;
+        return objective_estimate > other.objective_estimate;
     };
 
     bool operator<=(const MoveData& other) const
     {
-        return quality_estimate <= other.quality_estimate;
+        return objective_estimate <= other.objective_estimate;
     };
 
     bool operator>=(const MoveData& other) const
     {
-        return quality_estimate >= other.quality_estimate;
+        return objective_estimate >= other.objective_estimate;
     };
 };
 
-#endif /* MOVEDATA_HPP_ */
+#endif /* MOVEDATA_HPP_ */
\ No newline at end of file
@@ -12,20 +12,27 @@
 #define NEIGHBORHOODS_HPP_
 
 #include <algorithm>
+#include <memory_resource>
+
+#include <utils/instrumentation.hpp>
 
 namespace
 {
     template <typename Iter, typename Solution, typename Neighborhood>
-    Iter FindNeighbors(Iter dest, const Solution& solution, const Neighborhood& neighborhood)
+    Iter FindNeighbors(Iter dest, const Solution& solution, std::pmr::memory_resource* resource, const Neighborhood& neighborhood)
     {
-        return neighborhood.GetNeighbors(dest, solution);
+        return neighborhood.GetNeighbors(dest, solution, resource);
     }
 
     template <typename Iter, typename Solution, typename Neighborhood, typename... Neighborhoods>
-    Iter FindNeighbors(Iter dest, const Solution& solution, const Neighborhood& neighborhood, const Neighborhoods&... neighborhoods)
+    Iter FindNeighbors(Iter dest,
+                       const Solution& solution,
+                       std::pmr::memory_resource* resource,
+                       const Neighborhood& neighborhood,
+                       const Neighborhoods&... neighborhoods)
     {
-        dest = neighborhood.GetNeighbors(dest, solution);
-        return FindNeighbors(dest, solution, neighborhoods...);
+        dest = neighborhood.GetNeighbors(dest, solution, resource);
+        return FindNeighbors(dest, solution, resource, neighborhoods...);
     }
 }
 
@@ -38,14 +45,20 @@ namespace
  * @tparam Neighborhoods type of the additional neighborhoods to be used to calculate the neighbors.
  * @param dest iterator to be used to insert the neighbors.
  * @param solution solution whose neighbors will be calculated.
+ * @param resource memory resource of the moves and of the temporary containers of the neighborhoods.
  * @param neighborhood neighborhood to be used to calculate the neighbors.
  * @param neighborhoods additional neighborhoods to be used to calculate the neighbors.
  * @return an iterator to the neighbor past the last neighbor inserted. 
  */
 template <typename Iter, typename Solution, typename Neighborhood, typename... Neighborhoods>
-Iter GetNeighbors(Iter dest, const Solution& solution, const Neighborhood& neighborhood, const Neighborhoods&... neighborhoods)
+Iter GetNeighbors(Iter dest,
+                  const Solution& solution,
+                  std::pmr::memory_resource* resource,
+                  const Neighborhood& neighborhood,
+                  const Neighborhoods&... neighborhoods)
 {
-    return FindNeighbors(dest, solution, neighborhood, neighborhoods...);
+    JSP_SCOPED_TIMER(Probe::GetNeighbors);
+    return FindNeighbors(dest, solution, resource, neighborhood, neighborhoods...);
 }
 
 #endif /* NEIGHBORHOODS_HPP_ */
\ No newline at end of file
@@ -0,0 +1,221 @@
+/**
+ * @file search_budget.hpp
+ * @author Pablo
+ * @brief Time and evaluation budgets for the metaheuristics.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef SEARCHBUDGET_HPP_
+#define SEARCHBUDGET_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+/**
+ * @brief Limits the resources (wall-clock time and number of evaluations) that a search can consume, and lets another thread cancel the search.
+ * The clock and the cancellation flag are only read once every few checks, so the budget can be checked in the inner loops of the algorithms.
+ * 
+ */
+class SearchBudget
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+  private:
+    Clock::time_point start; // instant in which the budget started to be consumed
+    Clock::duration time_limit; // maximum wall-clock time
+    unsigned long long evaluation_limit; // maximum number of evaluations
+    unsigned long long evaluations; // number of evaluations consumed
+    unsigned int sampling_period; // number of checks between two reads of the clock
+    unsigned int checks; // number of checks since the last read of the clock
+    const std::atomic<bool>* cancellation; // flag that cancels the search when it is set, nullptr if the search cannot be cancelled
+    bool exhausted; // true once any of the limits has been reached or the search has been cancelled
+    bool finished; // true if the search has been finished because it cannot improve its best solution
+
+  public:
+    /**
+     * @brief Constructs a new SearchBudget. The budget starts to be consumed at construction.
+     * 
+     * @param time_limit maximum wall-clock time.
+     * @param evaluation_limit maximum number of evaluations.
+     * @param sampling_period number of checks between two reads of the clock.
+     */
+    explicit SearchBudget(Clock::duration time_limit = Clock::duration::max(),
+                          unsigned long long evaluation_limit = std::numeric_limits<unsigned long long>::max(),
+                          unsigned int sampling_period = 8) :
+        start{Clock::now()},
+        time_limit{time_limit},
+        evaluation_limit{evaluation_limit},
+        evaluations{0},
+        sampling_period{sampling_period == 0 ? 1 : sampling_period},
+        checks{0},
+        cancellation{nullptr},
+        exhausted{false},
+        finished{false}
+    {}
+
+    /**
+     * @brief Sets the flag that cancels the search. The budget is exhausted at the first check after the flag is set.
+     * 
+     * @param flag flag that cancels the search, it must outlive the budget, or nullptr if the search cannot be cancelled.
+     */
+    void SetCancellationFlag(const std::atomic<bool>* flag)
+    {
+        cancellation = flag;
+    }
+
+    /**
+     * @brief Checks if the search has been cancelled.
+     * 
+     * @return true if the cancellation flag is set, false in other case.
+     */
+    bool Cancelled() const
+    {
+        return cancellation != nullptr && cancellation->load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Restarts the budget, the elapsed time and the evaluations are set to zero. The cancellation flag is kept.
+     * 
+     */
+    void Restart()
+    {
+        start = Clock::now();
+        evaluations = 0;
+        checks = 0;
+        exhausted = false;
+        finished = false;
+    }
+
+    /**
+     * @brief Finishes the search, the budget is exhausted at once. It is used when the best solution is proven to be optimal
+     * (its objective reaches a lower bound), so the rest of the budget would be wasted.
+     * 
+     */
+    void Finish()
+    {
+        finished = true;
+        exhausted = true;
+    }
+
+    /**
+     * @brief Checks if the search has been finished before exhausting its limits.
+     * 
+     * @return true if the search has been finished, false in other case.
+     */
+    bool Finished() const
+    {
+        return finished;
+    }
+
+    /**
+     * @brief Adds evaluations to the consumed budget.
+     * 
+     * @param number number of evaluations.
+     */
+    void AddEvaluations(unsigned long long number)
+    {
+        evaluations += number;
+    }
+
+    /**
+     * @brief Checks if the budget is exhausted. Once exhausted, the budget remains exhausted until it is restarted.
+     * 
+     * @return true if any of the limits has been reached or the search has been cancelled or finished, false in other case.
+     */
+    bool Exhausted()
+    {
+        if (exhausted) {
+            return true;
+        }
+        if (evaluations >= evaluation_limit) {
+            exhausted = true;
+        } else if (++checks >= sampling_period) {
+            checks = 0;
+            exhausted = (time_limit != Clock::duration::max() && Clock::now() - start >= time_limit) || Cancelled();
+        }
+        return exhausted;
+    }
+
+    /**
+     * @brief Checks if the budget is exhausted reading the clock and the cancellation flag at once, for the checks between
+     * steps that are too expensive to wait for the next read (like decoding a whole individual of a large instance).
+     * 
+     * @return true if any of the limits has been reached or the search has been cancelled or finished, false in other case.
+     */
+    bool ExhaustedNow()
+    {
+        checks = sampling_period;
+        return Exhausted();
+    }
+
+    /**
+     * @brief Returns the wall-clock time elapsed since the budget started.
+     * 
+     * @return the wall-clock time elapsed since the budget started.
+     */
+    Clock::duration Elapsed() const
+    {
+        return Clock::now() - start;
+    }
+
+    /**
+     * @brief Returns the number of evaluations consumed.
+     * 
+     * @return the number of evaluations consumed.
+     */
+    unsigned long long GetEvaluations() const
+    {
+        return evaluations;
+    }
+
+    /**
+     * @brief Returns a budget that shares the limits of this budget (the time, the evaluations and the cancellation flag)
+     * but can consume at most the given number of evaluations more. The evaluations consumed from the slice have to be added
+     * back to this budget.
+     * 
+     * @param number maximum number of evaluations that the slice can consume.
+     * @return the slice of the budget.
+     */
+    SearchBudget Slice(unsigned long long number) const
+    {
+        SearchBudget slice(*this);
+        if (number < evaluation_limit - std::min(evaluations, evaluation_limit)) {
+            slice.evaluation_limit = evaluations + number;
+        }
+        return slice;
+    }
+
+    /**
+     * @brief Returns a budget that shares the limits of this budget but can last at most the given wall-clock time more.
+     * The evaluations consumed from the slice have to be added back to this budget.
+     * 
+     * @param time maximum wall-clock time that the slice can last.
+     * @return the slice of the budget.
+     */
+    SearchBudget Slice(Clock::duration time) const
+    {
+        SearchBudget slice(*this);
+        auto elapsed = Elapsed();
+        if (time_limit == Clock::duration::max() || time < time_limit - std::min(elapsed, time_limit)) {
+            slice.time_limit = elapsed + time;
+        }
+        return slice;
+    }
+};
+
+/**
+ * @brief Improvement callback that discards the solutions.
+ * 
+ */
+struct IgnoreImprovements
+{
+    template <typename Solution> void operator()(const Solution&) const {}
+};
+
+#endif /* SEARCHBUDGET_HPP_ */
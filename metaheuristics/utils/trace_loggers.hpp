@@ -0,0 +1,193 @@
+/**
+ * @file trace_loggers.hpp
+ * @author Pablo
+ * @brief Loggers that stream the trace of the algorithms to a binary file.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef TRACELOGGERS_HPP_
+#define TRACELOGGERS_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+
+#include <metaheuristics/utils/evolutionary_algorithm_logger.hpp>
+#include <metaheuristics/utils/local_search_logger.hpp>
+#include <metaheuristics/utils/trace_writer.hpp>
+
+/**
+ * @brief Logger that streams the trace of an evolutionary algorithm to a TraceWriter. No logs are kept in memory.
+ * 
+ * @tparam Solution type of the solutions to be logged.
+ */
+template <typename Solution> class TraceEvolutionaryAlgorithmLogger
+{
+  public:
+    using SolutionType = Solution;
+
+  private:
+    TraceWriter& writer;
+    std::uint32_t generation; // generation of the next log
+    std::optional<SolutionType> best_solution;
+
+  public:
+    /**
+     * @brief Constructs a new TraceEvolutionaryAlgorithmLogger.
+     * 
+     * @param writer writer where the logs will be appended.
+     */
+    explicit TraceEvolutionaryAlgorithmLogger(TraceWriter& writer) : writer{writer}, generation{0} {};
+
+    /**
+     * @brief Sets the best solution found by the algorithm.
+     * 
+     * @param solution to set as the best solution found by the algorithm.
+     */
+    void SetBestSolution(const SolutionType& solution)
+    {
+        best_solution = solution;
+    }
+
+    /**
+     * @brief Appends a log to the trace.
+     * 
+     * @param average_quality average quality of the solutions.
+     * @param maximum_quality maximum quality of the solutions.
+     * @param msg optional message.
+     */
+    void AddLog(double average_quality, double maximum_quality, EvolutionaryAlgorithmLogMessage msg = EvolutionaryAlgorithmLogMessage::None)
+    {
+        TraceRecord record{};
+        record.timestamp = writer.Now();
+        record.quality = maximum_quality;
+        record.average_quality = average_quality;
+        record.generation = generation++;
+        record.source = static_cast<std::uint8_t>(TraceSource::EvolutionaryAlgorithm);
+        record.msg = static_cast<std::uint8_t>(msg);
+        writer.Write(record);
+    }
+
+    /**
+     * @brief The logs are streamed to disk, so no logs are inserted.
+     * 
+     * @tparam Iter type of the iterator to be used to insert the logs.
+     * @param dest iterator to be used to insert the logs.
+     * @return dest.
+     */
+    template <typename Iter> Iter GetHistory(Iter dest) const
+    {
+        return dest;
+    }
+
+    constexpr explicit operator bool() const
+    {
+        return true;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const TraceEvolutionaryAlgorithmLogger& logger)
+    {
+        return os << "Best solution found" << std::endl << (logger.best_solution.has_value() ? logger.best_solution->ToString() : "");
+    }
+};
+
+/**
+ * @brief Logger that streams the trace of a local search to a TraceWriter. No logs are kept in memory.
+ * When used inside a memetic algorithm the restart messages set the generation of the following logs.
+ * 
+ * @tparam Solution type of the solutions to be logged.
+ */
+template <typename Solution> class TraceLocalSearchLogger
+{
+  public:
+    using SolutionType = Solution;
+
+  private:
+    TraceWriter& writer;
+    std::uint32_t generation; // generation of the memetic algorithm in which the local search is run
+    std::uint32_t iteration; // iteration of the next log
+    std::optional<SolutionType> best_solution;
+
+  public:
+    /**
+     * @brief Constructs a new TraceLocalSearchLogger.
+     * 
+     * @param writer writer where the logs will be appended.
+     */
+    explicit TraceLocalSearchLogger(TraceWriter& writer) : writer{writer}, generation{0}, iteration{0} {};
+
+    /**
+     * @brief The initial solution is not kept.
+     * 
+     */
+    void SetInitialSolution(const SolutionType&) {}
+
+    /**
+     * @brief Sets the best solution found by the algorithm.
+     * 
+     * @param solution to set as the best solution found by the algorithm.
+     */
+    void SetBestSolution(const SolutionType& solution)
+    {
+        best_solution = solution;
+    }
+
+    /**
+     * @brief Appends a log to the trace.
+     * 
+     * @param quality quality of the selected solution.
+     * @param neighbors_generated neighbors generated in the iteration.
+     * @param neighbors_evaluated neighbors evaluated in the iteration.
+     * @param msg optional message.
+     * @param value value attached to the message.
+     */
+    void AddLog(double quality,
+                unsigned int neighbors_generated,
+                unsigned int neighbors_evaluated,
+                LocalSearchLogMessage msg = LocalSearchLogMessage::None,
+                unsigned int value = 0)
+    {
+        if (msg == LocalSearchLogMessage::RestartOffspring1 || msg == LocalSearchLogMessage::RestartOffspring2) {
+            generation = value;
+            iteration = 0;
+        }
+        TraceRecord record{};
+        record.timestamp = writer.Now();
+        record.quality = quality;
+        record.generation = generation;
+        record.iteration = iteration++;
+        record.neighbors_generated = neighbors_generated;
+        record.neighbors_evaluated = neighbors_evaluated;
+        record.value = value;
+        record.source = static_cast<std::uint8_t>(TraceSource::LocalSearch);
+        record.msg = static_cast<std::uint8_t>(msg);
+        writer.Write(record);
+    }
+
+    /**
+     * @brief The logs are streamed to disk, so no logs are inserted.
+     * 
+     * @tparam Iter type of the iterator to be used to insert the logs.
+     * @param dest iterator to be used to insert the logs.
+     * @return dest.
+     */
+    template <typename Iter> Iter GetHistory(Iter dest) const
+    {
+        return dest;
+    }
+
+    constexpr explicit operator bool() const
+    {
+        return true;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const TraceLocalSearchLogger& logger)
+    {
+        return os << "Best solution found" << std::endl << (logger.best_solution.has_value() ? logger.best_solution->ToString() : "");
+    }
+};
+
+#endif /* TRACELOGGERS_HPP_ */
@@ -0,0 +1,202 @@
+/**
+ * @file trace_writer.hpp
+ * @author Pablo
+ * @brief Streaming writer of binary traces.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef TRACEWRITER_HPP_
+#define TRACEWRITER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Algorithm that produced a trace record.
+ * 
+ */
+enum class TraceSource : std::uint8_t
+{
+    EvolutionaryAlgorithm, // record of a generation of an evolutionary algorithm
+    LocalSearch // record of an iteration of a local search
+};
+
+/**
+ * @brief Fixed-size record of a binary trace. The records are written to disk as they are in memory.
+ * 
+ */
+struct TraceRecord
+{
+    std::int64_t timestamp; // nanoseconds since the creation of the trace
+    double quality; // quality of the current solution (local search) or maximum quality (evolutionary algorithm)
+    double average_quality; // average quality of the population (evolutionary algorithm)
+    std::uint32_t generation; // generation of the evolutionary algorithm
+    std::uint32_t iteration; // iteration of the local search
+    std::uint32_t neighbors_generated; // neighbors generated in the iteration
+    std::uint32_t neighbors_evaluated; // neighbors evaluated in the iteration
+    std::uint32_t value; // value attached to the message
+    std::uint8_t source; // TraceSource of the record
+    std::uint8_t msg; // message code, LocalSearchLogMessage or EvolutionaryAlgorithmLogMessage depending on the source
+    std::uint16_t reserved; // padding, always zero
+};
+
+static_assert(sizeof(TraceRecord) == 48, "the layout of the trace records is part of the file format");
+static_assert(std::is_trivially_copyable<TraceRecord>::value, "the trace records are written as raw memory");
+
+/**
+ * @brief Appends trace records to a binary file. The records are stored in a buffer that, once full, is handed
+ * to a background thread that writes it to disk while the other buffer is being filled, so the producer only
+ * waits if the disk cannot keep up with it. A single thread can write records.
+ * 
+ * The file starts with a header made of the magic string "JSPTRACE", the version of the format and the size
+ * of the records (both 32-bit unsigned integers), followed by the records. All the values use the native byte order.
+ * 
+ */
+class TraceWriter
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t version = 1; // version of the file format
+
+  private:
+    std::ofstream file;
+    std::vector<TraceRecord> front; // buffer being filled by the producer
+    std::vector<TraceRecord> back; // buffer being written by the background thread
+    std::size_t capacity; // number of records of each buffer
+    Clock::time_point start; // instant in which the trace was created
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool pending; // true while the back buffer has records to be written
+    bool stop; // true once the background thread has to finish
+    std::thread writer; // background thread, constructed the last
+
+    /**
+     * @brief Body of the background thread, writes the back buffer each time it is handed over.
+     * 
+     */
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [this]() { return pending || stop; });
+            if (!pending) {
+                return;
+            }
+            lock.unlock();
+            file.write(reinterpret_cast<const char*>(back.data()), back.size() * sizeof(TraceRecord));
+            file.flush();
+            back.clear();
+            lock.lock();
+            pending = false;
+            condition.notify_all();
+        }
+    }
+
+    /**
+     * @brief Hands the front buffer to the background thread, waiting for it to finish with the previous one.
+     * 
+     */
+    void Swap()
+    {
+        if (front.empty()) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return !pending; });
+        std::swap(front, back);
+        pending = true;
+        condition.notify_all();
+    }
+
+  public:
+    /**
+     * @brief Constructs a new TraceWriter. If the file exists it is overwritten.
+     * 
+     * @param path path of the file where the trace will be written.
+     * @param capacity number of records of each buffer.
+     */
+    explicit TraceWriter(const std::string& path, std::size_t capacity = 1 << 12) :
+        file(path, std::ios::binary | std::ios::trunc),
+        capacity{capacity == 0 ? 1 : capacity},
+        start{Clock::now()},
+        pending{false},
+        stop{false}
+    {
+        if (!file) {
+            throw std::invalid_argument("cannot open trace file " + path);
+        }
+        const std::uint32_t record_size = sizeof(TraceRecord);
+        file.write("JSPTRACE", 8);
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        file.write(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+        front.reserve(this->capacity);
+        back.reserve(this->capacity);
+        writer = std::thread(&TraceWriter::Run, this);
+    }
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    /**
+     * @brief Destroys the TraceWriter, the pending records are written before closing the file.
+     * 
+     */
+    ~TraceWriter()
+    {
+        Flush();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        condition.notify_all();
+        writer.join();
+    }
+
+    /**
+     * @brief Returns the nanoseconds elapsed since the creation of the trace.
+     * 
+     * @return the nanoseconds elapsed since the creation of the trace.
+     */
+    std::int64_t Now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    }
+
+    /**
+     * @brief Appends a record to the trace.
+     * 
+     * @param record record to be appended.
+     */
+    void Write(const TraceRecord& record)
+    {
+        front.push_back(record);
+        if (front.size() == capacity) {
+            Swap();
+        }
+    }
+
+    /**
+     * @brief Writes to disk all the records appended so far, waiting for the background thread to finish.
+     * 
+     */
+    void Flush()
+    {
+        Swap();
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return !pending; });
+    }
+};
+
+#endif /* TRACEWRITER_HPP_ */
@@ -61,9 +61,27 @@ template <typename Task, typename Job, typename Machine> class JSP
         if (machines.count(machineID) == 0) {
             throw std::invalid_argument("the machine is not registered");
         }
-        tasks.insert(std::make_pair(taskID, TaskType{taskID, jobs.at(jobID), machines.at(machineID), job_tasks[jobID].size(), duration}));
-        job_tasks[jobID].push_back(tasks.at(taskID));
-        machine_tasks[machineID].insert(tasks.at(taskID));
+        auto& tasks_of_job = job_tasks[jobID];
+        auto inserted = tasks.insert(std::make_pair(taskID, TaskType{taskID, jobs.at(jobID), machines.at(machineID), tasks_of_job.size(), duration}));
+        const TaskType& task = inserted.first->second;
+        tasks_of_job.push_back(task);
+        machine_tasks[machineID].insert(task);
+    }
+
+    /**
+     * @brief Reserves space for the specified number of jobs and machines (with a task of each job in each machine),
+     * so the problem can be filled without rehashing.
+     * 
+     * @param number_of_jobs number of jobs.
+     * @param number_of_machines number of machines.
+     */
+    void Reserve(std::size_t number_of_jobs, std::size_t number_of_machines)
+    {
+        tasks.reserve(number_of_jobs * number_of_machines);
+        jobs.reserve(number_of_jobs);
+        machines.reserve(number_of_machines);
+        job_tasks.reserve(number_of_jobs);
+        machine_tasks.reserve(number_of_machines);
     }
 
     /**
@@ -0,0 +1,343 @@
+/**
+ * @file jsp_binary_instance.hpp
+ * @author Pablo
+ * @brief Binary format of JSP instances.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef JSPBINARYINSTANCE_HPP_
+#define JSPBINARYINSTANCE_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <problems/jsp/jsp.hpp>
+#include <utils/mapped_file.hpp>
+#include <utils/template_utils.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+/**
+ * @brief Header of a binary JSP instance.
+ * 
+ */
+struct JSPBinaryHeader
+{
+    char magic[8]; // "JSPINST" followed by a null character
+    std::uint32_t version; // version of the format
+    std::uint32_t byte_order; // 0x01020304 written in the byte order of the machine that wrote the file
+    std::uint32_t flags; // JSPBinaryInstance::fuzzy and JSPBinaryInstance::due_dates
+    std::uint32_t jobs; // number of jobs
+    std::uint32_t machines; // number of machines
+    std::uint32_t reserved; // padding, always 0
+};
+
+static_assert(sizeof(JSPBinaryHeader) == 32, "the binary header must not have padding");
+
+/**
+ * @brief Read-only view of a binary JSP instance, that is memory-mapped and used in place.
+ * After the header the file has the following arrays, each job with its tasks in processing order:
+ * the durations of the tasks as triples of doubles (a crisp duration d is stored as (d,d,d)), the due dates of the jobs
+ * as triples of doubles, the weights of the jobs as doubles and the machines (from 0) of the tasks as 32-bit integers.
+ * All the arrays are aligned to 8 bytes, so the view returns pointers into the mapped file.
+ * 
+ */
+class JSPBinaryInstance
+{
+  public:
+    static constexpr std::uint32_t version = 1; // version of the file format
+    static constexpr std::uint32_t byte_order = 0x01020304; // byte order mark
+    static constexpr std::uint32_t fuzzy = 1; // flag of the instances with some non-degenerate fuzzy number
+    static constexpr std::uint32_t due_dates = 2; // flag of the instances with due dates and weights
+
+  private:
+    MappedFile file; // contents of the file
+    JSPBinaryHeader header; // header of the file
+    const double* durations; // durations of the tasks
+    const double* dates; // due dates of the jobs
+    const double* weights; // weights of the jobs
+    const std::uint32_t* machines; // machines of the tasks
+
+    /**
+     * @brief Returns the size of the file of an instance.
+     * 
+     * @param jobs number of jobs.
+     * @param machines number of machines.
+     * @return the size of the file.
+     */
+    static std::size_t FileSize(std::size_t jobs, std::size_t machines)
+    {
+        return sizeof(JSPBinaryHeader) + jobs * machines * 3 * sizeof(double) + jobs * 3 * sizeof(double) + jobs * sizeof(double) +
+               jobs * machines * sizeof(std::uint32_t);
+    }
+
+    /**
+     * @brief Returns the components of a number as a triple.
+     * 
+     * @tparam T type of the number.
+     * @param value number.
+     * @return the components of the number as a triple.
+     */
+    template <typename T> static std::array<double, 3> ToTriple(const T& value)
+    {
+        if constexpr (is_specialization<T, TriangularFuzzyNumber>::value) {
+            return {static_cast<double>(value.GetSmallest()), static_cast<double>(value.GetMostProbable()), static_cast<double>(value.GetLargest())};
+        } else {
+            return {static_cast<double>(value), static_cast<double>(value), static_cast<double>(value)};
+        }
+    }
+
+    /**
+     * @brief Returns the number with the components of a triple.
+     * 
+     * @tparam T type of the number.
+     * @param triple components of the number.
+     * @return the number.
+     */
+    template <typename T> static T FromTriple(const double* triple)
+    {
+        if constexpr (is_specialization<T, TriangularFuzzyNumber>::value) {
+            using InnerType = decltype(std::declval<T>().GetSmallest());
+            return T(static_cast<InnerType>(triple[0]), static_cast<InnerType>(triple[1]), static_cast<InnerType>(triple[2]));
+        } else {
+            if (triple[0] != triple[1] || triple[1] != triple[2]) {
+                throw std::invalid_argument("a fuzzy number cannot be stored in a crisp type");
+            }
+            return static_cast<T>(triple[0]);
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs a new JSPBinaryInstance.
+     * 
+     * @param path path of the file.
+     */
+    explicit JSPBinaryInstance(const std::string& path) : file{path}
+    {
+        if (file.size() < sizeof(JSPBinaryHeader)) {
+            throw std::invalid_argument(path + " is not a binary instance");
+        }
+        std::memcpy(&header, file.begin(), sizeof(JSPBinaryHeader));
+        if (std::memcmp(header.magic, "JSPINST", 8) != 0) {
+            throw std::invalid_argument(path + " is not a binary instance");
+        }
+        if (header.byte_order != byte_order) {
+            throw std::invalid_argument(path + " was written with a different byte order");
+        }
+        if (header.version != version) {
+            throw std::invalid_argument(path + " has version " + std::to_string(header.version) + ", expected " + std::to_string(version));
+        }
+        if (file.size() != FileSize(header.jobs, header.machines)) {
+            throw std::invalid_argument(path + " is truncated");
+        }
+        std::size_t tasks = static_cast<std::size_t>(header.jobs) * header.machines;
+        durations = reinterpret_cast<const double*>(file.begin() + sizeof(JSPBinaryHeader));
+        dates = durations + tasks * 3;
+        weights = dates + header.jobs * 3;
+        machines = reinterpret_cast<const std::uint32_t*>(weights + header.jobs);
+        for (std::size_t i = 0; i < tasks; i++) {
+            if (machines[i] >= header.machines) {
+                throw std::invalid_argument(path + " has a machine out of range");
+            }
+        }
+    }
+
+    /**
+     * @brief Checks if a file is a binary instance.
+     * 
+     * @param path path of the file.
+     * @return true if the file starts with the magic string of the binary instances, false in other case.
+     */
+    static bool IsBinaryInstance(const std::string& path)
+    {
+        char magic[8] = {};
+        std::ifstream is(path, std::ios::binary);
+        return is.read(magic, sizeof(magic)) && std::memcmp(magic, "JSPINST", 8) == 0;
+    }
+
+    /**
+     * @brief Writes a problem in binary format. The jobs must be numbered from 1 and the machines from 1.
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem to be written.
+     * @param path path of the file, overwritten if it exists.
+     * @param with_due_dates true if the due dates and weights are meaningful, false in other case.
+     */
+    template <typename Problem> static void Write(const Problem& problem, const std::string& path, bool with_due_dates)
+    {
+        std::size_t jobs = problem.GetNumberOfJobs();
+        std::size_t machines = problem.GetNumberOfMachines();
+        std::vector<double> durations;
+        std::vector<double> dates;
+        std::vector<double> weights;
+        std::vector<std::uint32_t> task_machines;
+        bool non_degenerate = false;
+        for (unsigned int j = 1; j <= jobs; j++) {
+            if (problem.GetNumberOfTasksInJob(j) != machines) {
+                throw std::invalid_argument("job " + std::to_string(j) + " does not have a task in each machine");
+            }
+            for (std::size_t position = 0; position < machines; position++) {
+                const auto& task = problem.GetTask(j, position);
+                auto triple = ToTriple(task.GetDuration());
+                non_degenerate = non_degenerate || triple[0] != triple[1] || triple[1] != triple[2];
+                durations.insert(durations.end(), triple.begin(), triple.end());
+                task_machines.push_back(task.GetMachine().GetMachineID() - 1);
+            }
+            auto triple = ToTriple(problem.GetJob(j).GetDueDate());
+            non_degenerate = non_degenerate || triple[0] != triple[1] || triple[1] != triple[2];
+            dates.insert(dates.end(), triple.begin(), triple.end());
+            weights.push_back(problem.GetJob(j).GetWeight());
+        }
+
+        JSPBinaryHeader header = {{'J', 'S', 'P', 'I', 'N', 'S', 'T', '\0'},
+                                  version,
+                                  byte_order,
+                                  (non_degenerate ? fuzzy : 0) | (with_due_dates ? due_dates : 0),
+                                  static_cast<std::uint32_t>(jobs),
+                                  static_cast<std::uint32_t>(machines),
+                                  0};
+        std::ofstream os(path, std::ios::binary | std::ios::trunc);
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(durations.data()), durations.size() * sizeof(double));
+        os.write(reinterpret_cast<const char*>(dates.data()), dates.size() * sizeof(double));
+        os.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(double));
+        os.write(reinterpret_cast<const char*>(task_machines.data()), task_machines.size() * sizeof(std::uint32_t));
+        if (!os) {
+            throw std::invalid_argument("cannot write " + path);
+        }
+    }
+
+    /**
+     * @brief Returns the number of jobs.
+     * 
+     * @return the number of jobs.
+     */
+    std::size_t GetNumberOfJobs() const
+    {
+        return header.jobs;
+    }
+
+    /**
+     * @brief Returns the number of machines.
+     * 
+     * @return the number of machines.
+     */
+    std::size_t GetNumberOfMachines() const
+    {
+        return header.machines;
+    }
+
+    /**
+     * @brief Returns the flags of the instance.
+     * 
+     * @return the flags of the instance.
+     */
+    std::uint32_t GetFlags() const
+    {
+        return header.flags;
+    }
+
+    /**
+     * @brief Returns the machine (from 0) of the task of a job in a position.
+     * 
+     * @param job job (from 0).
+     * @param position position of the task in the job.
+     * @return the machine of the task.
+     */
+    std::uint32_t GetMachine(std::size_t job, std::size_t position) const
+    {
+        return machines[job * header.machines + position];
+    }
+
+    /**
+     * @brief Returns the duration of the task of a job in a position.
+     * 
+     * @tparam Time type of the duration.
+     * @param job job (from 0).
+     * @param position position of the task in the job.
+     * @return the duration of the task.
+     */
+    template <typename Time> Time GetDuration(std::size_t job, std::size_t position) const
+    {
+        return FromTriple<Time>(durations + (job * header.machines + position) * 3);
+    }
+
+    /**
+     * @brief Returns the due date of a job.
+     * 
+     * @tparam Date type of the due date.
+     * @param job job (from 0).
+     * @return the due date of the job.
+     */
+    template <typename Date> Date GetDueDate(std::size_t job) const
+    {
+        return FromTriple<Date>(dates + job * 3);
+    }
+
+    /**
+     * @brief Returns the weight of a job.
+     * 
+     * @param job job (from 0).
+     * @return the weight of the job.
+     */
+    double GetWeight(std::size_t job) const
+    {
+        return weights[job];
+    }
+
+    /**
+     * @brief Builds the problem of the instance, with the same identifiers as the text readers.
+     * 
+     * @tparam Task type of the tasks.
+     * @tparam Job type of the jobs.
+     * @tparam Machine type of the machines.
+     * @return the problem of the instance.
+     */
+    template <typename Task, typename Job, typename Machine> JSP<Task, Job, Machine> GetProblem() const
+    {
+        JSP<Task, Job, Machine> jsp;
+        unsigned int machines_per_job = header.machines;
+        jsp.Reserve(header.jobs, header.machines);
+        std::vector<bool> registered(header.machines, false); // machines already added, in the same order as the text readers
+        for (unsigned int j = 1; j <= header.jobs; j++) {
+            if (header.flags & due_dates) {
+                jsp.AddJob(j, GetDueDate<typename Job::DateType>(j - 1), GetWeight(j - 1));
+            } else {
+                jsp.AddJob(j);
+            }
+            for (unsigned int m = 0; m < machines_per_job; m++) {
+                if (!registered[GetMachine(j - 1, m)]) {
+                    jsp.AddMachine(GetMachine(j - 1, m) + 1);
+                    registered[GetMachine(j - 1, m)] = true;
+                }
+                jsp.AddTask(j * machines_per_job + m + 1, j, GetMachine(j - 1, m) + 1, GetDuration<typename Task::TimeType>(j - 1, m));
+            }
+        }
+        return jsp;
+    }
+};
+
+/**
+ * @brief Reads a JSP instance in binary format.
+ * 
+ * @tparam Task type of the tasks.
+ * @tparam Job type of the jobs.
+ * @tparam Machine type of the machines.
+ * @param path path of the file.
+ * @return the problem read.
+ */
+template <typename Task, typename Job, typename Machine> JSP<Task, Job, Machine> read_binary(const std::string& path)
+{
+    return JSPBinaryInstance(path).GetProblem<Task, Job, Machine>();
+}
+
+#endif /* JSPBINARYINSTANCE_HPP_ */
@@ -0,0 +1,712 @@
+/**
+ * @file jsp_branch_and_bound.hpp
+ * @author Pablo
+ * @brief Exact branch and bound for the makespan minimization of small JSP instances.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef JSPBRANCHANDBOUND_HPP_
+#define JSPBRANCHANDBOUND_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp_lower_bounds.hpp>
+#include <problems/jsp/jsp_schedule_generation_schemes.hpp>
+
+/**
+ * @brief Branch and bound that minimizes the makespan of a JSP with crisp durations (Brucker, Jurisch and Sievers, 1994).
+ * Each node of the tree is a partial selection of the disjunctive graph, the orders fixed between pairs of tasks of the same
+ * machine. At each node:
+ * - the heads and tails of the tasks are the longest paths of the partial graph, and the node is pruned when a task or the
+ *   Jackson preemptive schedule of a machine cannot end before the best makespan found;
+ * - the orders that every better schedule must follow are fixed by immediate selection (on pairs of tasks) and edge-finding
+ *   (a task that must be the first or the last of a set of tasks of its machine), which also raise the heads and tails;
+ * - a schedule that follows the selection is built, and the tree branches on the blocks of its critical path: a better
+ *   schedule must move a task of a block before or after all the other tasks of the block.
+ * 
+ * The tree is explored depth-first until the budget is exhausted, each node counts as an evaluation. If the tree is explored
+ * completely the best schedule is optimal and the budget is finished.
+ * 
+ */
+class JSPBranchAndBound
+{
+  private:
+    /**
+     * @brief State of the search, with the tasks of the problem numbered consecutively.
+     * 
+     * @tparam Time type of the time unit.
+     * @tparam Publish type of the function called with the machine sequences of each new best schedule.
+     */
+    template <typename Time, typename Publish> class Search
+    {
+      private:
+        static constexpr unsigned int none = std::numeric_limits<unsigned int>::max(); // missing task
+
+        // change of a node, undone when the node is left
+        struct Change
+        {
+            enum Kind
+            {
+                Arc, // order fixed between the tasks
+                Release, // raise of the head of the first task
+                Deadline // raise of the tail of the first task
+            } kind;
+            unsigned int task1;
+            unsigned int task2;
+            Time value; // previous value of the raised head or tail
+        };
+
+        // child of a node, a task of a critical block is moved before or after the rest of the block, and the first and
+        // last tasks of the previous blocks are kept in place
+        struct Branch
+        {
+            std::vector<std::pair<unsigned int, unsigned int>> arcs; // orders fixed by the child
+            Time bound; // bound of the makespan of the child
+        };
+
+        SearchBudget& budget; // budget of the search
+        const Publish& publish; // function called with each new best schedule
+        std::size_t size; // number of tasks
+        std::vector<Time> duration; // duration of each task
+        std::vector<unsigned int> job_predecessor; // previous task of the job of each task
+        std::vector<unsigned int> job_successor; // next task of the job of each task
+        std::vector<unsigned int> machine; // machine of each task
+        std::vector<std::vector<unsigned int>> machine_tasks; // tasks of each machine
+        std::vector<char> before; // before[a * size + b] is true if task a precedes task b in the selection
+        std::vector<unsigned int> machine_predecessors; // number of tasks that precede each task in the selection
+        std::vector<Time> longest; // longest duration of the tasks of each machine
+        std::vector<char> in_set; // true for the tasks of the set being checked by edge-finding
+        std::vector<Time> release; // minimum head of each task, raised by edge-finding
+        std::vector<Time> deadline; // minimum tail of each task, raised by edge-finding
+        std::vector<Time> head; // head of each task in the current node
+        std::vector<Time> tail; // tail of each task in the current node
+        std::vector<Change> trail; // changes of the current branch
+        bool changed; // true if the last propagation step has changed the node
+        Time upper_bound; // makespan of the best schedule
+        std::vector<unsigned int> best_sequence; // position of each task in the machine sequences of the best schedule
+        bool interrupted; // true if the budget has been exhausted before exploring the tree completely
+
+        bool Fix(unsigned int from, unsigned int to)
+        {
+            if (before[to * size + from]) {
+                return false;
+            }
+            if (!before[from * size + to]) {
+                before[from * size + to] = true;
+                machine_predecessors[to]++;
+                trail.push_back({Change::Arc, from, to, Time{}});
+                changed = true;
+            }
+            return true;
+        }
+
+        void Raise(std::vector<Time>& bounds, typename Change::Kind kind, unsigned int task, Time value)
+        {
+            if (bounds[task] < value) {
+                trail.push_back({kind, task, task, bounds[task]});
+                bounds[task] = value;
+                changed = true;
+            }
+        }
+
+        void Undo(std::size_t mark)
+        {
+            while (trail.size() > mark) {
+                const Change& change = trail.back();
+                if (change.kind == Change::Arc) {
+                    before[change.task1 * size + change.task2] = false;
+                    machine_predecessors[change.task2]--;
+                } else if (change.kind == Change::Release) {
+                    release[change.task1] = change.value;
+                } else {
+                    deadline[change.task1] = change.value;
+                }
+                trail.pop_back();
+            }
+        }
+
+        // computes the heads and tails as the longest paths of the partial graph, false if it has a cycle
+        bool LongestPaths()
+        {
+            std::vector<unsigned int> predecessors(size, 0);
+            for (unsigned int task = 0; task < size; task++) {
+                predecessors[task] = (job_predecessor[task] != none) + machine_predecessors[task];
+            }
+            std::vector<unsigned int> order;
+            order.reserve(size);
+            for (unsigned int task = 0; task < size; task++) {
+                if (predecessors[task] == 0) {
+                    order.push_back(task);
+                }
+                head[task] = release[task];
+            }
+            for (std::size_t i = 0; i < order.size(); i++) {
+                unsigned int task = order[i];
+                Time end = head[task] + duration[task];
+                const auto relax = [&](unsigned int next) {
+                    head[next] = std::max(head[next], end);
+                    if (--predecessors[next] == 0) {
+                        order.push_back(next);
+                    }
+                };
+                if (job_successor[task] != none) {
+                    relax(job_successor[task]);
+                }
+                for (unsigned int other: machine_tasks[machine[task]]) {
+                    if (before[task * size + other]) {
+                        relax(other);
+                    }
+                }
+            }
+            if (order.size() != size) {
+                return false;
+            }
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                unsigned int task = *it;
+                tail[task] = deadline[task];
+                if (job_successor[task] != none) {
+                    tail[task] = std::max(tail[task], duration[job_successor[task]] + tail[job_successor[task]]);
+                }
+                for (unsigned int other: machine_tasks[machine[task]]) {
+                    if (before[task * size + other]) {
+                        tail[task] = std::max(tail[task], duration[other] + tail[other]);
+                    }
+                }
+            }
+            return true;
+        }
+
+        // fixes the orders of the pairs of tasks whose other order cannot lead to a better schedule
+        bool ImmediateSelection(const std::vector<unsigned int>& tasks)
+        {
+            for (std::size_t i = 0; i < tasks.size(); i++) {
+                for (std::size_t j = i + 1; j < tasks.size(); j++) {
+                    unsigned int a = tasks[i];
+                    unsigned int b = tasks[j];
+                    if (before[a * size + b] || before[b * size + a]) {
+                        continue;
+                    }
+                    bool a_first = head[a] + duration[a] + duration[b] + tail[b] < upper_bound;
+                    bool b_first = head[b] + duration[b] + duration[a] + tail[a] < upper_bound;
+                    if (!a_first && !b_first) {
+                        return false;
+                    }
+                    if (!a_first) {
+                        Fix(b, a);
+                    } else if (!b_first) {
+                        Fix(a, b);
+                    }
+                }
+            }
+            return true;
+        }
+
+        // fixes the tasks that must be processed before (input) or after (output) a set of tasks of their machine, for the
+        // task intervals (the tasks whose heads and tails are not smaller than those of two tasks)
+        bool EdgeFinding(const std::vector<unsigned int>& tasks)
+        {
+            std::vector<unsigned int> sorted(tasks);
+            std::vector<unsigned int> set;
+            for (bool input: {true, false}) {
+                const auto& start = input ? head : tail; // side where the sets start
+                const auto& end = input ? tail : head; // side where the sets end
+                std::sort(sorted.begin(), sorted.end(), [&start](unsigned int a, unsigned int b) { return start[a] > start[b]; });
+                for (unsigned int threshold: tasks) {
+                    Time length{};
+                    Time end_of_set = std::numeric_limits<Time>::max();
+                    set.clear();
+                    for (unsigned int member: sorted) {
+                        if (end[member] < end[threshold]) {
+                            continue;
+                        }
+                        set.push_back(member);
+                        in_set[member] = true;
+                        length += duration[member];
+                        end_of_set = std::min(end_of_set, end[member]);
+                        if (start[member] + length + longest[machine[member]] + end_of_set < upper_bound) {
+                            continue;
+                        }
+                        for (unsigned int task: tasks) {
+                            // if the task is not the first (last) of the set, the set starts at the smallest start of its tasks
+                            if (in_set[task] || start[member] + length + duration[task] + std::min(end_of_set, end[task]) < upper_bound) {
+                                continue;
+                            }
+                            for (unsigned int other: set) {
+                                if (!(input ? Fix(task, other) : Fix(other, task))) {
+                                    for (unsigned int j: set) {
+                                        in_set[j] = false;
+                                    }
+                                    return false;
+                                }
+                            }
+                            // the task ends (starts) after the set is processed
+                            Raise(input ? deadline : release, input ? Change::Deadline : Change::Release, task, length + end_of_set);
+                        }
+                    }
+                    for (unsigned int member: set) {
+                        in_set[member] = false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        // returns the Jackson preemptive schedule bound of a machine
+        Time JacksonBound(std::vector<unsigned int> tasks) const
+        {
+            std::sort(tasks.begin(), tasks.end(), [this](unsigned int a, unsigned int b) { return head[a] < head[b]; });
+            std::priority_queue<std::pair<Time, Time>> available; // tails and remaining durations
+            std::size_t next = 0;
+            Time time = head[tasks.front()];
+            Time bound{};
+            while (next < tasks.size() || !available.empty()) {
+                if (available.empty()) {
+                    time = std::max(time, head[tasks[next]]);
+                }
+                while (next < tasks.size() && !(time < head[tasks[next]])) {
+                    available.emplace(tail[tasks[next]], duration[tasks[next]]);
+                    next++;
+                }
+                auto [task_tail, remaining] = available.top();
+                available.pop();
+                if (next < tasks.size() && head[tasks[next]] < time + remaining) {
+                    remaining -= head[tasks[next]] - time;
+                    time = head[tasks[next]];
+                    available.emplace(task_tail, remaining);
+                } else {
+                    time += remaining;
+                    bound = std::max(bound, time + task_tail);
+                }
+            }
+            return bound;
+        }
+
+        // propagates the selection of the node until a fixpoint, false if the node cannot lead to a better schedule
+        bool Propagate(Time& lower_bound)
+        {
+            do {
+                if (!LongestPaths()) {
+                    return false;
+                }
+                lower_bound = Time{};
+                for (unsigned int task = 0; task < size; task++) {
+                    lower_bound = std::max(lower_bound, head[task] + duration[task] + tail[task]);
+                }
+                if (!(lower_bound < upper_bound)) {
+                    return false;
+                }
+                // the cheap immediate selection is repeated until it has no effect before trying the edge-finding
+                changed = false;
+                for (const auto& tasks: machine_tasks) {
+                    if (!ImmediateSelection(tasks)) {
+                        return false;
+                    }
+                }
+                for (std::size_t machine = 0; machine < machine_tasks.size() && !changed; machine++) {
+                    if (!EdgeFinding(machine_tasks[machine])) {
+                        return false;
+                    }
+                }
+            } while (changed);
+            for (const auto& tasks: machine_tasks) {
+                if (!tasks.empty()) {
+                    lower_bound = std::max(lower_bound, JacksonBound(tasks));
+                }
+            }
+            return lower_bound < upper_bound;
+        }
+
+        // builds a semi-active schedule that follows the selection, dispatching the task that can start first
+        // (the one with the largest tail in case of tie), and returns its makespan
+        Time Schedule(std::vector<Time>& start, std::vector<unsigned int>& machine_predecessor, std::vector<unsigned int>& sequence) const
+        {
+            std::vector<unsigned int> predecessors(size, 0);
+            for (unsigned int task = 0; task < size; task++) {
+                predecessors[task] = (job_predecessor[task] != none) + machine_predecessors[task];
+            }
+            std::vector<unsigned int> last(machine_tasks.size(), none); // last task scheduled in each machine
+            std::vector<unsigned int> ready;
+            for (unsigned int task = 0; task < size; task++) {
+                if (predecessors[task] == 0) {
+                    ready.push_back(task);
+                }
+            }
+            const auto earliest = [&](unsigned int task) {
+                Time time{};
+                if (job_predecessor[task] != none) {
+                    time = start[job_predecessor[task]] + duration[job_predecessor[task]];
+                }
+                if (last[machine[task]] != none) {
+                    time = std::max(time, start[last[machine[task]]] + duration[last[machine[task]]]);
+                }
+                return time;
+            };
+            Time makespan{};
+            for (unsigned int position = 0; position < size; position++) {
+                // Giffler and Thompson: among the tasks of the machine of the task that can end first, which can start
+                // before it ends, the one with the largest tail
+                auto first = std::min_element(ready.begin(), ready.end(), [&](unsigned int a, unsigned int b) {
+                    return earliest(a) + duration[a] < earliest(b) + duration[b];
+                });
+                Time end = earliest(*first) + duration[*first];
+                auto chosen = first;
+                for (auto it = ready.begin(); it != ready.end(); ++it) {
+                    if (machine[*it] == machine[*first] && earliest(*it) < end &&
+                        (tail[*it] > tail[*chosen] || (tail[*it] == tail[*chosen] && earliest(*it) < earliest(*chosen)))) {
+                        chosen = it;
+                    }
+                }
+                unsigned int task = *chosen;
+                ready.erase(chosen);
+                start[task] = earliest(task);
+                machine_predecessor[task] = last[machine[task]];
+                last[machine[task]] = task;
+                sequence[task] = position;
+                makespan = std::max(makespan, start[task] + duration[task]);
+                const auto release_task = [&](unsigned int next) {
+                    if (--predecessors[next] == 0) {
+                        ready.push_back(next);
+                    }
+                };
+                if (job_successor[task] != none) {
+                    release_task(job_successor[task]);
+                }
+                for (unsigned int other: machine_tasks[machine[task]]) {
+                    if (before[task * size + other]) {
+                        release_task(other);
+                    }
+                }
+            }
+            return makespan;
+        }
+
+        // returns the blocks of a critical path of a schedule, the maximal sequences of tasks of the same machine
+        std::vector<std::vector<unsigned int>>
+        CriticalBlocks(const std::vector<Time>& start, const std::vector<unsigned int>& machine_predecessor, Time makespan) const
+        {
+            unsigned int task = 0;
+            while (start[task] + duration[task] != makespan) {
+                task++;
+            }
+            std::vector<std::vector<unsigned int>> blocks;
+            std::vector<unsigned int> block{task};
+            while (true) {
+                unsigned int previous = machine_predecessor[task];
+                if (previous != none && start[previous] + duration[previous] == start[task]) {
+                    block.push_back(previous);
+                } else {
+                    if (block.size() > 1) {
+                        std::reverse(block.begin(), block.end());
+                        blocks.push_back(std::move(block));
+                    }
+                    block.clear();
+                    previous = job_predecessor[task];
+                    if (previous == none || start[previous] + duration[previous] != start[task]) {
+                        break;
+                    }
+                    block.push_back(previous);
+                }
+                task = previous;
+            }
+            return blocks;
+        }
+
+        bool Fix(const Branch& branch)
+        {
+            for (const auto& [from, to]: branch.arcs) {
+                if (!Fix(from, to)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // computes the bound of a branch from the longest paths of its graph, false if the branch is infeasible
+        bool Bound(Branch& branch)
+        {
+            std::size_t mark = trail.size();
+            bool feasible = Fix(branch) && LongestPaths();
+            if (feasible) {
+                branch.bound = Time{};
+                for (unsigned int task = 0; task < size; task++) {
+                    branch.bound = std::max(branch.bound, head[task] + duration[task] + tail[task]);
+                }
+            }
+            Undo(mark);
+            return feasible;
+        }
+
+        void Explore()
+        {
+            if (budget.Exhausted()) {
+                interrupted = true;
+                return;
+            }
+            budget.AddEvaluations(1);
+            std::size_t mark = trail.size();
+            Time lower_bound{};
+            if (Propagate(lower_bound)) {
+                std::vector<Time> start(size);
+                std::vector<unsigned int> machine_predecessor(size);
+                std::vector<unsigned int> sequence(size);
+                Time makespan = Schedule(start, machine_predecessor, sequence);
+                if (makespan < upper_bound) {
+                    upper_bound = makespan;
+                    best_sequence = sequence;
+                    publish(best_sequence);
+                }
+                if (lower_bound < upper_bound) {
+                    // a better schedule moves a task of a block before or after all the other tasks of the block, the
+                    // children are explored from the smallest to the largest bound
+                    std::vector<Branch> children;
+                    std::vector<std::pair<unsigned int, unsigned int>> previous; // arcs that keep the previous blocks in place
+                    for (const auto& block: CriticalBlocks(start, machine_predecessor, makespan)) {
+                        for (std::size_t i = 0; i < block.size(); i++) {
+                            for (bool first: {true, false}) {
+                                if ((first && i == 0) || (!first && i + 1 == block.size())) {
+                                    continue;
+                                }
+                                Branch child{previous, Time{}};
+                                for (unsigned int other: block) {
+                                    if (other != block[i]) {
+                                        child.arcs.push_back(first ? std::make_pair(block[i], other) : std::make_pair(other, block[i]));
+                                    }
+                                }
+                                if (Bound(child) && child.bound < upper_bound) {
+                                    children.push_back(std::move(child));
+                                }
+                            }
+                        }
+                        for (std::size_t i = 1; i < block.size(); i++) {
+                            previous.emplace_back(block.front(), block[i]);
+                            previous.emplace_back(block[i - 1], block.back());
+                        }
+                    }
+                    std::stable_sort(children.begin(), children.end(), [](const Branch& a, const Branch& b) { return a.bound < b.bound; });
+                    for (const Branch& child: children) {
+                        if (interrupted || !(child.bound < upper_bound)) {
+                            break;
+                        }
+                        std::size_t branch = trail.size();
+                        if (Fix(child)) {
+                            Explore();
+                        }
+                        Undo(branch);
+                    }
+                }
+            }
+            Undo(mark);
+        }
+
+      public:
+        template <typename Problem>
+        Search(SearchBudget& budget,
+               const Publish& publish,
+               const Problem& problem,
+               const std::vector<std::reference_wrapper<const typename Problem::TaskType>>& tasks) :
+            budget{budget},
+            publish{publish},
+            size{tasks.size()},
+            duration(size),
+            job_predecessor(size, none),
+            job_successor(size, none),
+            machine(size),
+            before(size * size, false),
+            machine_predecessors(size, 0),
+            in_set(size, false),
+            release(size, Time{}),
+            deadline(size, Time{}),
+            head(size),
+            tail(size),
+            changed{false},
+            upper_bound{std::numeric_limits<Time>::max()},
+            interrupted{false}
+        {
+            using Components = TimeComponents<typename Problem::TimeType>;
+            std::unordered_map<unsigned int, unsigned int> index; // index of each task
+            std::unordered_map<unsigned int, unsigned int> machine_index; // index of each machine
+            for (unsigned int task = 0; task < size; task++) {
+                index[tasks[task].get().GetTaskID()] = task;
+            }
+            for (unsigned int task = 0; task < size; task++) {
+                const auto& t = tasks[task].get();
+                duration[task] = Components::Get(t.GetDuration(), 0);
+                auto [it, inserted] = machine_index.emplace(t.GetMachine().GetMachineID(), machine_tasks.size());
+                if (inserted) {
+                    machine_tasks.emplace_back();
+                    longest.push_back(duration[task]);
+                }
+                machine[task] = it->second;
+                machine_tasks[it->second].push_back(task);
+                longest[it->second] = std::max(longest[it->second], duration[task]);
+                if (t.GetPosition() + 1 < problem.GetNumberOfTasksInJob(t.GetJob().GetJobID())) {
+                    unsigned int next = index.at(problem.GetTask(t.GetJob().GetJobID(), t.GetPosition() + 1).GetTaskID());
+                    job_successor[task] = next;
+                    job_predecessor[next] = task;
+                }
+            }
+        }
+
+        /**
+         * @brief Sets the best schedule found before the search, only better schedules are looked for.
+         * 
+         * @param sequence position of each task in the machine sequences of the schedule.
+         * @param makespan makespan of the schedule.
+         */
+        void SetIncumbent(const std::vector<unsigned int>& sequence, Time makespan)
+        {
+            best_sequence = sequence;
+            upper_bound = makespan;
+        }
+
+        /**
+         * @brief Explores the tree.
+         * 
+         * @return true if the tree has been explored completely, false if the budget has been exhausted before.
+         */
+        bool Run()
+        {
+            if (best_sequence.empty()) {
+                // the schedule of the root is the incumbent, so there is one even if the budget is exhausted before exploring
+                std::vector<Time> start(size);
+                std::vector<unsigned int> machine_predecessor(size);
+                std::vector<unsigned int> sequence(size);
+                upper_bound = Schedule(start, machine_predecessor, sequence);
+                best_sequence = sequence;
+                publish(best_sequence);
+            }
+            Explore();
+            return !interrupted;
+        }
+
+        const std::vector<unsigned int>& GetBestSequence() const
+        {
+            return best_sequence;
+        }
+    };
+
+    template <typename Solution, typename Problem>
+    static Solution Decode(const std::vector<std::reference_wrapper<const typename Problem::TaskType>>& tasks,
+                           const std::vector<unsigned int>& sequence,
+                           const Problem& problem)
+    {
+        std::vector<std::pair<std::reference_wrapper<const typename Problem::TaskType>, unsigned int>> priorities;
+        for (std::size_t task = 0; task < tasks.size(); task++) {
+            priorities.emplace_back(tasks[task], sequence[task]);
+        }
+        return BuildSolution<Solution>(priorities.begin(), priorities.end(), problem);
+    }
+
+    template <typename Solution, typename ImprovementCallback, typename Problem>
+    static Solution Solve(SearchBudget& budget,
+                          const ImprovementCallback& improvement_callback,
+                          const Problem& problem,
+                          const Solution* initial_solution)
+    {
+        using TaskType = typename Problem::TaskType;
+        using Components = TimeComponents<typename Problem::TimeType>;
+        if (!IsApplicable(problem)) {
+            throw std::invalid_argument("the branch and bound needs crisp durations");
+        }
+        std::vector<std::reference_wrapper<const TaskType>> tasks;
+        problem.GetTasks(std::back_inserter(tasks));
+        std::sort(tasks.begin(), tasks.end(), [](const TaskType& a, const TaskType& b) { return a.GetTaskID() < b.GetTaskID(); });
+        const auto publish = [&](const std::vector<unsigned int>& sequence) {
+            if constexpr (!std::is_same<ImprovementCallback, IgnoreImprovements>::value) {
+                improvement_callback(Decode<Solution>(tasks, sequence, problem));
+            }
+        };
+        Search<typename Components::Type, decltype(publish)> search(budget, publish, problem, tasks);
+        if (initial_solution != nullptr) {
+            // the topological order of the schedule follows its machine sequences
+            std::vector<std::reference_wrapper<const TaskType>> order;
+            initial_solution->GetTasksTopologicalOrder(std::back_inserter(order));
+            std::unordered_map<unsigned int, unsigned int> position;
+            for (unsigned int i = 0; i < order.size(); i++) {
+                position[order[i].get().GetTaskID()] = i;
+            }
+            std::vector<unsigned int> sequence;
+            for (const TaskType& task: tasks) {
+                sequence.push_back(position.at(task.GetTaskID()));
+            }
+            search.SetIncumbent(sequence, Components::Get(initial_solution->GetMakespan(), 0));
+        }
+        if (search.Run()) {
+            budget.Finish();
+        }
+        return Decode<Solution>(tasks, search.GetBestSequence(), problem);
+    }
+
+  public:
+    /**
+     * @brief Checks if the branch and bound can solve a problem, if the durations of its tasks are crisp (or fuzzy numbers
+     * whose components are equal).
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem to be solved.
+     * @return true if the branch and bound can solve the problem, false in other case.
+     */
+    template <typename Problem> static bool IsApplicable(const Problem& problem)
+    {
+        using Components = TimeComponents<typename Problem::TimeType>;
+        std::vector<std::reference_wrapper<const typename Problem::TaskType>> tasks;
+        problem.GetTasks(std::back_inserter(tasks));
+        return problem.GetNumberOfTasks() > 0 && std::all_of(tasks.begin(), tasks.end(), [](const auto& task) {
+                   for (std::size_t component = 1; component < Components::size; component++) {
+                       if (Components::Get(task.get().GetDuration(), component) != Components::Get(task.get().GetDuration(), 0)) {
+                           return false;
+                       }
+                   }
+                   return true;
+               });
+    }
+
+    /**
+     * @brief Finds the schedule with the minimum makespan of a problem. The budget is finished if the schedule is proven to
+     * be optimal.
+     * 
+     * @tparam Solution type of the solution, it has to minimize the makespan.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @param budget budget that limits the resources that the search can consume, each node is counted as an evaluation.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved, its durations must be crisp (see IsApplicable).
+     * @return the best solution found.
+     */
+    template <typename Solution, typename ImprovementCallback, typename Problem>
+    static Solution FindSolution(SearchBudget& budget, const ImprovementCallback& improvement_callback, const Problem& problem)
+    {
+        return Solve<Solution>(budget, improvement_callback, problem, nullptr);
+    }
+
+    /**
+     * @brief Finds the schedule with the minimum makespan of a problem, starting from a known schedule whose makespan bounds
+     * the search. The budget is finished if the best schedule is proven to be optimal.
+     * 
+     * @tparam Solution type of the solution, it has to minimize the makespan.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @param budget budget that limits the resources that the search can consume, each node is counted as an evaluation.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param initial_solution known schedule of the problem, its durations must be crisp (see IsApplicable).
+     * @return the best solution found.
+     */
+    template <typename Solution, typename ImprovementCallback>
+    static Solution FindSolution(SearchBudget& budget, const ImprovementCallback& improvement_callback, const Solution& initial_solution)
+    {
+        return Solve<Solution>(budget, improvement_callback, initial_solution.GetProblem(), &initial_solution);
+    }
+};
+
+#endif /* JSPBRANCHANDBOUND_HPP_ */
@@ -13,6 +13,7 @@
 
 #include <random>
 
+#include <metaheuristics/utils/search_budget.hpp>
 #include <problems/jsp/jsp_genetic_encoders.hpp>
 #include <problems/jsp/jsp_schedule_generation_schemes.hpp>
 
@@ -38,6 +39,28 @@ class JSPRandomPopulationGenerator
      */
     template <typename Solution, typename Iter, typename Problem, typename RNG>
     static Iter GetIndividuals(Iter dest, const Problem& problem, unsigned int population_size, RNG& rng)
+    {
+        SearchBudget budget;
+        return GetIndividuals<Solution>(dest, problem, population_size, rng, budget);
+    }
+
+    /**
+     * @brief Inserts in a container a population of random individuals, each of them consumes an evaluation of the budget.
+     * If the budget is exhausted the population is cut short, but it has at least one individual.
+     * 
+     * @tparam Solution type of the solutions.
+     * @tparam Iter type of the iterator to be used to insert the individuals.
+     * @tparam Problem type of the problem.
+     * @tparam RNG random number generator.
+     * @param dest iterator to be used to insert the individuals.
+     * @param problem base problem.
+     * @param population_size size of the population (maximum number of individuals).
+     * @param rng random number generator.
+     * @param budget budget that limits the resources that the generation can consume.
+     * @return an iterator to the individual past the last individual inserted.   
+     */
+    template <typename Solution, typename Iter, typename Problem, typename RNG>
+    static Iter GetIndividuals(Iter dest, const Problem& problem, unsigned int population_size, RNG& rng, SearchBudget& budget)
     {
         using JobType = typename Problem::JobType;
         std::vector<unsigned int> master_pattern;
@@ -47,9 +70,10 @@ class JSPRandomPopulationGenerator
         for (const JobType& job: jobs) {
             std::fill_n(inserter, problem.GetNumberOfTasksInJob(job.GetJobID()), job.GetJobID());
         }
-        for (unsigned int i = 0; i < population_size; i++) {
+        for (unsigned int i = 0; i < population_size && (i == 0 || !budget.ExhaustedNow()); i++) {
             std::shuffle(master_pattern.begin(), master_pattern.end(), rng);
             ++dest = std::move(PermutationWithRepetition<GT>::DecodeSolution<Solution>(master_pattern.begin(), master_pattern.end(), problem));
+            budget.AddEvaluations(1);
         }
         return dest;
     }
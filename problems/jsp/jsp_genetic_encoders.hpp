@@ -11,6 +11,8 @@
 #ifndef JSPGENETICENCODERS_HPP_
 #define JSPGENETICENCODERS_HPP_
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
 #include <type_traits>
 #include <unordered_map>
@@ -55,6 +57,37 @@ template <typename Decoder> class PermutationWithRepetition
     }
 
   public:
+    /**
+     * @brief Checks if a chromosome encodes a solution of a problem, that is, if each gene is the identifier of a job of the
+     * problem and each job appears as many times as it has tasks.
+     * 
+     * @tparam Iter type of the iterator to be used to read the genes.
+     * @tparam Problem type of the problem.
+     * @param first iterator pointing to the first gene of the encoded solution.
+     * @param last iterator pointing to the gene past the last gene of the encoded solution.
+     * @param problem problem to be solved.
+     * @return true if the chromosome encodes a solution of the problem.
+     */
+    template <typename Iter, typename Problem> static bool IsValidChromosome(Iter first, Iter last, const Problem& problem)
+    {
+        using JobType = typename Problem::JobType;
+        // remaining genes of each job
+        std::unordered_map<unsigned int, std::size_t> remaining;
+        std::vector<std::reference_wrapper<const JobType>> jobs;
+        problem.GetJobs(std::back_inserter(jobs));
+        for (const JobType& job: jobs) {
+            remaining[job.GetJobID()] = problem.GetNumberOfTasksInJob(job.GetJobID());
+        }
+        for (; first != last; ++first) {
+            auto it = remaining.find(*first);
+            if (it == remaining.end() || it->second == 0) {
+                return false;
+            }
+            it->second--;
+        }
+        return std::all_of(remaining.begin(), remaining.end(), [](const auto& pair) { return pair.second == 0; });
+    }
+
     /**
      * @brief Inserts in a container the genes of the encoded solution.
      * 
@@ -0,0 +1,335 @@
+/**
+ * @file jsp_lower_bounds.hpp
+ * @author Pablo
+ * @brief Lower bounds of the objectives of a JSP.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef JSPLOWERBOUNDS_HPP_
+#define JSPLOWERBOUNDS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <utils/template_utils.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+/**
+ * @brief Splits the durations of a JSP in crisp components, so a bound of a crisp JSP can be computed for each of them.
+ * A crisp duration has a single component.
+ * 
+ * @tparam T type of the durations.
+ */
+template <typename T> struct TimeComponents
+{
+    using Type = T; // type of the components
+    static constexpr std::size_t size = 1; // number of components
+
+    static T Get(const T& value, std::size_t)
+    {
+        return value;
+    }
+
+    static T Make(const std::array<T, size>& components)
+    {
+        return components[0];
+    }
+};
+
+/**
+ * @brief The components of a triangular fuzzy number are its smallest, most probable and largest values. The sum and the
+ * maximum of fuzzy numbers are computed component by component, so each component of the objective of a schedule is the
+ * objective of the same schedule in the crisp JSP whose durations are that component, and a bound of each crisp JSP is
+ * a bound of the corresponding component.
+ * 
+ * @tparam T type of the components of the fuzzy numbers.
+ */
+template <typename T> struct TimeComponents<TriangularFuzzyNumber<T>>
+{
+    using Type = T;
+    static constexpr std::size_t size = 3;
+
+    static T Get(const TriangularFuzzyNumber<T>& value, std::size_t component)
+    {
+        return component == 0 ? value.GetSmallest() : component == 1 ? value.GetMostProbable() : value.GetLargest();
+    }
+
+    static TriangularFuzzyNumber<T> Make(const std::array<T, size>& components)
+    {
+        return TriangularFuzzyNumber<T>(components[0], components[1], components[2]);
+    }
+};
+
+/**
+ * @brief Provides static functions to compute lower bounds of the makespan and the total weighted tardiness of a JSP from
+ * its data, without scheduling it. A solution whose objective reaches a lower bound is optimal.
+ * 
+ */
+class JSPLowerBounds
+{
+  private:
+    /**
+     * @brief Task of a crisp relaxation of the problem.
+     * 
+     * @tparam Time type of the time unit.
+     */
+    template <typename Time> struct Operation
+    {
+        unsigned int machine; // identifier of the machine of the task
+        Time head; // sum of the durations of the previous tasks of its job
+        Time duration; // duration of the task
+        Time tail; // sum of the durations of the next tasks of its job
+    };
+
+    /**
+     * @brief Crisp relaxation of the problem, one of the components of its durations with the order of the tasks of each job.
+     * 
+     * @tparam Time type of the time unit.
+     * @tparam Date type of the date unit.
+     */
+    template <typename Time, typename Date> struct Relaxation
+    {
+        std::vector<std::vector<Operation<Time>>> jobs; // tasks of each job, in order
+        std::vector<Date> due_dates; // due date of each job
+        std::vector<double> weights; // weight of each job
+    };
+
+    /**
+     * @brief Returns the crisp relaxation of a component of the durations of the problem.
+     * 
+     */
+    template <typename Problem> static auto GetRelaxation(const Problem& problem, std::size_t component)
+    {
+        using Components = TimeComponents<typename Problem::TimeType>;
+        Relaxation<typename Components::Type, typename Problem::DateType> relaxation;
+        std::vector<std::reference_wrapper<const typename Problem::JobType>> jobs;
+        problem.GetJobs(std::back_inserter(jobs));
+        for (const auto& job: jobs) {
+            std::vector<std::reference_wrapper<const typename Problem::TaskType>> tasks;
+            problem.GetJobTasks(std::back_inserter(tasks), job.get().GetJobID());
+            std::vector<Operation<typename Components::Type>> operations;
+            typename Components::Type head{};
+            for (const auto& task: tasks) {
+                typename Components::Type duration = Components::Get(task.get().GetDuration(), component);
+                operations.push_back({task.get().GetMachine().GetMachineID(), head, duration, {}});
+                head += duration;
+            }
+            for (auto& operation: operations) {
+                operation.tail = head - operation.head - operation.duration;
+            }
+            relaxation.jobs.push_back(std::move(operations));
+            relaxation.due_dates.push_back(job.get().GetDueDate());
+            relaxation.weights.push_back(job.get().GetWeight());
+        }
+        return relaxation;
+    }
+
+    /**
+     * @brief Groups the tasks of a relaxation by machine.
+     * 
+     */
+    template <typename Time, typename Date>
+    static std::unordered_map<unsigned int, std::vector<Operation<Time>>> MachineTasks(const Relaxation<Time, Date>& relaxation)
+    {
+        std::unordered_map<unsigned int, std::vector<Operation<Time>>> machines;
+        for (const auto& job: relaxation.jobs) {
+            for (const auto& operation: job) {
+                machines[operation.machine].push_back(operation);
+            }
+        }
+        return machines;
+    }
+
+    /**
+     * @brief Computes a crisp bound for each component of the durations of the problem and assembles them.
+     * 
+     */
+    template <typename Problem, typename Bound> static typename Problem::TimeType Componentwise(const Problem& problem, const Bound& bound)
+    {
+        using Components = TimeComponents<typename Problem::TimeType>;
+        std::array<typename Components::Type, Components::size> components;
+        for (std::size_t component = 0; component < Components::size; component++) {
+            components[component] = bound(GetRelaxation(problem, component));
+        }
+        return Components::Make(components);
+    }
+
+    template <typename Time, typename Date> static Time JobBound(const Relaxation<Time, Date>& relaxation)
+    {
+        Time bound{};
+        for (const auto& job: relaxation.jobs) {
+            if (!job.empty()) {
+                bound = std::max(bound, job.back().head + job.back().duration);
+            }
+        }
+        return bound;
+    }
+
+    template <typename Time, typename Date> static Time MachineBound(const Relaxation<Time, Date>& relaxation)
+    {
+        Time bound{};
+        for (const auto& [machine, operations]: MachineTasks(relaxation)) {
+            Time head = operations.front().head;
+            Time tail = operations.front().tail;
+            Time load{};
+            for (const auto& operation: operations) {
+                head = std::min(head, operation.head);
+                tail = std::min(tail, operation.tail);
+                load += operation.duration;
+            }
+            bound = std::max(bound, head + load + tail);
+        }
+        return bound;
+    }
+
+    template <typename Time, typename Date> static Time JacksonBound(const Relaxation<Time, Date>& relaxation)
+    {
+        Time bound{};
+        for (auto& [machine, operations]: MachineTasks(relaxation)) {
+            std::sort(operations.begin(), operations.end(), [](const auto& a, const auto& b) { return a.head < b.head; });
+            // available tasks, the one with the largest tail first, with their remaining durations
+            std::priority_queue<std::pair<Time, Time>> available;
+            std::size_t next = 0;
+            Time time = operations.front().head;
+            while (next < operations.size() || !available.empty()) {
+                if (available.empty()) {
+                    time = std::max(time, operations[next].head);
+                }
+                while (next < operations.size() && !(time < operations[next].head)) {
+                    available.emplace(operations[next].tail, operations[next].duration);
+                    next++;
+                }
+                auto [tail, remaining] = available.top();
+                available.pop();
+                // the task is processed until it ends or a task is released
+                if (next < operations.size() && operations[next].head < time + remaining) {
+                    remaining -= operations[next].head - time;
+                    time = operations[next].head;
+                    available.emplace(tail, remaining);
+                } else {
+                    time += remaining;
+                    bound = std::max(bound, time + tail);
+                }
+            }
+        }
+        return bound;
+    }
+
+    template <typename Time, typename Date> static Time TotalWeightedTardinessBound(const Relaxation<Time, Date>& relaxation)
+    {
+        // each job ends after its tasks are processed one after another
+        double total = 0;
+        std::vector<double> tardiness(relaxation.jobs.size(), 0.0);
+        for (std::size_t j = 0; j < relaxation.jobs.size(); j++) {
+            if (!relaxation.jobs[j].empty()) {
+                Time completion = relaxation.jobs[j].back().head + relaxation.jobs[j].back().duration;
+                tardiness[j] = std::max(0.0, static_cast<double>(completion - relaxation.due_dates[j])) * relaxation.weights[j];
+            }
+            total += tardiness[j];
+        }
+        // and some job ends with the makespan, which is not smaller than its bound
+        Time makespan = std::max(JobBound(relaxation), JacksonBound(relaxation));
+        double increase = std::numeric_limits<double>::infinity();
+        for (std::size_t j = 0; j < relaxation.jobs.size(); j++) {
+            double last = std::max(0.0, static_cast<double>(makespan - relaxation.due_dates[j])) * relaxation.weights[j];
+            increase = std::min(increase, std::max(0.0, last - tardiness[j]));
+        }
+        return static_cast<Time>(relaxation.jobs.empty() ? total : total + increase);
+    }
+
+  public:
+    /**
+     * @brief Returns the job-based bound of the makespan, the largest sum of the durations of the tasks of a job.
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem whose makespan is bounded.
+     * @return the job-based bound of the makespan.
+     */
+    template <typename Problem> static typename Problem::TimeType Job(const Problem& problem)
+    {
+        return Componentwise(problem, [](const auto& relaxation) { return JobBound(relaxation); });
+    }
+
+    /**
+     * @brief Returns the machine-based bound of the makespan, the largest sum of the durations of the tasks of a machine plus
+     * the smallest head and the smallest tail of those tasks.
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem whose makespan is bounded.
+     * @return the machine-based bound of the makespan.
+     */
+    template <typename Problem> static typename Problem::TimeType Machine(const Problem& problem)
+    {
+        return Componentwise(problem, [](const auto& relaxation) { return MachineBound(relaxation); });
+    }
+
+    /**
+     * @brief Returns the one-machine preemptive bound of the makespan, the largest makespan of the Jackson preemptive schedules
+     * of the machines, where the heads and tails of the tasks are the durations of the previous and next tasks of their jobs.
+     * It is never smaller than the machine-based bound.
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem whose makespan is bounded.
+     * @return the one-machine preemptive bound of the makespan.
+     */
+    template <typename Problem> static typename Problem::TimeType Jackson(const Problem& problem)
+    {
+        return Componentwise(problem, [](const auto& relaxation) { return JacksonBound(relaxation); });
+    }
+
+    /**
+     * @brief Returns the best bound of the makespan, the largest of the job-based and the one-machine preemptive bounds.
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem whose makespan is bounded.
+     * @return the bound of the makespan.
+     */
+    template <typename Problem> static typename Problem::TimeType Makespan(const Problem& problem)
+    {
+        return Componentwise(problem, [](const auto& relaxation) { return std::max(JobBound(relaxation), JacksonBound(relaxation)); });
+    }
+
+    /**
+     * @brief Returns a bound of the total weighted tardiness. Each job ends after the sum of the durations of its tasks and
+     * the last one ends after the bound of the makespan, so the bound is the weighted tardiness of the jobs ending as soon as
+     * their tasks are processed, with the job whose tardiness increases the least ending at the bound of the makespan.
+     * 
+     * @tparam Problem type of the problem.
+     * @param problem problem whose total weighted tardiness is bounded.
+     * @return the bound of the total weighted tardiness.
+     */
+    template <typename Problem> static typename Problem::TimeType TotalWeightedTardiness(const Problem& problem)
+    {
+        return Componentwise(problem, [](const auto& relaxation) { return TotalWeightedTardinessBound(relaxation); });
+    }
+
+    /**
+     * @brief Returns the bound of the objective minimized by a type of solution.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam Problem type of the problem.
+     * @param problem problem whose objective is bounded.
+     * @return the bound of the objective.
+     */
+    template <typename Solution, typename Problem> static typename Problem::TimeType Objective(const Problem& problem)
+    {
+        if constexpr (is_specialization<Solution, JSPMakespanMinimizationSolution>::value) {
+            return Makespan(problem);
+        } else {
+            return TotalWeightedTardiness(problem);
+        }
+    }
+};
+
+#endif /* JSPLOWERBOUNDS_HPP_ */
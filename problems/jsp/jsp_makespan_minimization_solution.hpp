@@ -11,17 +11,21 @@
 #ifndef JSPMAKESPANMINIMIZATIONSOLUTION_HPP_
 #define JSPMAKESPANMINIMIZATIONSOLUTION_HPP_
 
+#include <cstdint>
+#include <memory_resource>
 #include <optional>
 #include <queue>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 
+#include <utils/instrumentation.hpp>
+#include <utils/objective_key.hpp>
 #include <utils/template_utils.hpp>
 #include <utils/triangular_fuzzy_number.hpp>
+#include <utils/zobrist.hpp>
 
 /**
  * @brief Solution to a JSP minimizing the makespan.
@@ -37,6 +41,7 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
     using JobType = typename ProblemType::JobType; // type of the jobs
     using MachineType = typename ProblemType::MachineType; // type of the machines
     using TimeType = typename TaskType::TimeType; // type of the time unit
+    using ObjectiveType = typename ObjectiveKey<TimeType>::type; // type of the key used to rank the solutions
   private:
     // struct to store the metadata of a task
     struct TaskMetadata
@@ -47,13 +52,17 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         std::optional<std::reference_wrapper<const TaskType>> machine_successor;
         TimeType head;
         TimeType tail;
+        bool changed = false; // true if the task has changed since the last heads and tails update
+        unsigned short pending = 0; // predecessors not sorted yet while sorting the tasks topologically
     };
     std::reference_wrapper<const ProblemType> problem; // problem to be solved
     mutable std::unordered_map<std::reference_wrapper<const TaskType>, TaskMetadata, std::hash<TaskType>, std::equal_to<TaskType>>
         disjunctive_graph; // disjunctive graph with the solution representation
-    mutable std::unordered_set<std::reference_wrapper<const TaskType>, std::hash<TaskType>, std::equal_to<TaskType>>
-        changes; // tasks that have changed since the last heads and tails update
+    mutable bool outdated = false; // true if some task has changed since the last heads and tails update
+    mutable std::vector<std::reference_wrapper<const TaskType>> order; // tasks sorted by the updates, empty between them to keep copies cheap
+    std::uint64_t hash; // Zobrist hash of the machine orders
     mutable TimeType makespan; // the current makespan
+    mutable ObjectiveType objective; // ranking key of the current makespan
 
   public:
     /**
@@ -61,30 +70,80 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
      * 
      * @param problem problem to be solved.
      */
-    JSPMakespanMinimizationSolution(const ProblemType& problem) : problem{problem} {}
+    JSPMakespanMinimizationSolution(const ProblemType& problem) : problem{problem}, hash{0} {}
 
   private:
+    /**
+     * @brief Marks a task as changed, so the next heads and tails update starts from it.
+     * 
+     * @param task task that has changed.
+     */
+    void MarkChanged(const TaskType& task)
+    {
+        disjunctive_graph.at(task).changed = true;
+        outdated = true;
+    }
+
+    /**
+     * @brief Sorts the tasks topologically in the order buffer, which does not allocate once it has grown to the number of tasks.
+     * 
+     */
+    void SortTopologically() const
+    {
+        order.clear();
+        order.reserve(disjunctive_graph.size());
+        for (auto& [task, metadata]: disjunctive_graph) {
+            metadata.pending = (metadata.job_predecessor.has_value() ? 1 : 0) + (metadata.machine_predecessor.has_value() ? 1 : 0);
+            if (metadata.pending == 0) {
+                order.push_back(task);
+            }
+        }
+        // the sorted tasks are also the queue of the tasks whose successors have to be visited
+        for (std::size_t i = 0; i < order.size(); i++) {
+            auto [job_successor, machine_successor] = GetNextTasks(order[i]);
+            if (job_successor.has_value() && --disjunctive_graph.at(*job_successor).pending == 0) {
+                order.push_back(*job_successor);
+            }
+            if (machine_successor.has_value() && --disjunctive_graph.at(*machine_successor).pending == 0) {
+                order.push_back(*machine_successor);
+            }
+        }
+        if (order.size() != disjunctive_graph.size()) {
+            order.clear();
+            throw std::invalid_argument("Not a DAG");
+        }
+    }
+
     /**
      * @brief Updates the head and tail of all the tasks that have been affected by modifications since the last call.
      * 
      */
     void UpdateHeadsAndTails() const
     {
-        if (!changes.empty()) {
-            std::vector<std::reference_wrapper<const TaskType>> tasks;
-            GetTasksTopologicalOrder(std::back_inserter(tasks));
-            // update the heads
-            // find the first task whose head has to be updated
-            auto it = tasks.begin();
-            while (it != tasks.end()) {
-                if (changes.count(*it) != 0) {
+        if (outdated) {
+            JSP_SCOPED_TIMER(Probe::UpdateHeadsAndTails);
+            SortTopologically();
+            // find the first task whose head has to be updated and "the last" task whose tail has to be updated
+            auto it = order.begin();
+            while (it != order.end()) {
+                if (disjunctive_graph.at(*it).changed) {
                     break;
                 }
                 ++it;
             }
-            // calculate the head of the tasks that are scheduled after the first modified task
-            while (it != tasks.end()) {
+            auto rit = order.rbegin();
+            if constexpr (Tails::value) {
+                while (rit != order.rend()) {
+                    if (disjunctive_graph.at(*rit).changed) {
+                        break;
+                    }
+                    ++rit;
+                }
+            }
+            // calculate the head of the tasks that are scheduled after the first modified task, which include all the modified tasks
+            while (it != order.end()) {
                 auto [job_predecessor, machine_predecessor] = GetPrevTasks(*it);
+                disjunctive_graph[*it].changed = false;
                 disjunctive_graph[*it].head = TimeType{};
                 if (job_predecessor.has_value()) {
                     disjunctive_graph[*it].head =
@@ -98,16 +157,8 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
             }
             // update the tails
             if constexpr (Tails::value) {
-                // find "the last" task whose tail has to be updated
-                auto rit = tasks.rbegin();
-                while (rit != tasks.rend()) {
-                    if (changes.count(*rit) != 0) {
-                        break;
-                    }
-                    ++rit;
-                }
                 // calculate the tail of the tasks that are scheduled before "the last" modified task
-                while (rit != tasks.rend()) {
+                while (rit != order.rend()) {
                     auto [job_successor, machine_successor] = GetNextTasks(*rit);
                     disjunctive_graph[*rit].tail = TimeType{};
                     if (job_successor.has_value()) {
@@ -121,14 +172,16 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
                     ++rit;
                 }
             }
-            changes.clear();
+            outdated = false;
             // calculate the latest task to be completed
-            std::vector<std::reference_wrapper<const TaskType>> final_tasks;
-            GetProblem().GetFinalTasks(std::back_inserter(final_tasks));
+            order.clear();
+            GetProblem().GetFinalTasks(std::back_inserter(order));
             makespan = TimeType{};
-            for (const TaskType& task: final_tasks) {
+            for (const TaskType& task: order) {
                 makespan = std::max(makespan, task.GetDuration() + disjunctive_graph.at(task).head);
             }
+            objective = ObjectiveKey<TimeType>::Get(makespan);
+            order.clear();
         }
     }
 
@@ -167,7 +220,19 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
      */
     double GetQuality() const
     {
-        return 1.0 / (double)GetMakespan();
+        return 1.0 / (double)GetObjective();
+    }
+
+    /**
+     * @brief Returns the key that ranks the solution, the makespan for integral times or its expected value for fuzzy times.
+     * The lower the key the better the solution. The algorithms compare these keys, which are exact for integral times.
+     * 
+     * @return the key that ranks the solution.
+     */
+    ObjectiveType GetObjective() const
+    {
+        UpdateHeadsAndTails();
+        return objective;
     }
 
     /**
@@ -195,15 +260,20 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
      * @tparam Block type of the critical blocks.
      * @tparam Iter type of the iterator to be used to insert the critical blocks.
      * @param dest iterator to be used to insert the critical blocks.
+     * @param allocator allocator of the blocks that are being built and of the temporary containers.
      * @return an iterator to the block past the last critical block inserted. 
      */
-    template <typename Block, typename Iter> Iter GetCriticalBlocks(Iter dest) const
+    template <typename Block, typename Iter>
+    Iter GetCriticalBlocks(Iter dest, const typename Block::allocator_type& allocator = typename Block::allocator_type{}) const
     {
         using BlockType = Block;
 
         UpdateHeadsAndTails();
 
-        const auto recursive_critical_blocks = [this](Iter dest, const auto& lambda, const TaskType& current_task, BlockType current_block) -> Iter {
+        const auto recursive_critical_blocks = [this, &allocator](Iter dest,
+                                                                  const auto& lambda,
+                                                                  const TaskType& current_task,
+                                                                  BlockType current_block) -> Iter {
             // get previous tasks
             auto [job_predecessor, machine_predecessor] = GetPrevTasks(current_task);
 
@@ -219,9 +289,9 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
                                                          disjunctive_graph.at(current_task).head)) {
                 if (!current_block.Empty()) {
                     *dest++ = current_block;
-                    dest = lambda(dest, lambda, *job_predecessor, BlockType{});
+                    dest = lambda(dest, lambda, *job_predecessor, BlockType(allocator));
                 } else {
-                    dest = lambda(dest, lambda, *job_predecessor, current_block);
+                    dest = lambda(dest, lambda, *job_predecessor, BlockType(current_block, allocator));
                 }
             }
 
@@ -230,22 +300,45 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
                 EqualTime(machine_predecessor->get().GetDuration() + disjunctive_graph.at(*machine_predecessor).head,
                           disjunctive_graph.at(current_task).head)) {
                 current_block.AddRestrictionFront(*machine_predecessor, current_task);
-                dest = lambda(dest, lambda, *machine_predecessor, current_block);
+                dest = lambda(dest, lambda, *machine_predecessor, std::move(current_block));
             }
 
             return dest;
         };
-        std::vector<std::reference_wrapper<const TaskType>> final_tasks;
+        std::pmr::vector<std::reference_wrapper<const TaskType>> final_tasks(allocator.resource());
         GetProblem().GetFinalTasks(std::back_inserter(final_tasks));
         for (const TaskType& final_task: final_tasks) {
             if (EqualTime(makespan, final_task.GetDuration() + disjunctive_graph.at(final_task).head)) {
-                dest = recursive_critical_blocks(dest, recursive_critical_blocks, final_task, BlockType{});
+                dest = recursive_critical_blocks(dest, recursive_critical_blocks, final_task, BlockType(allocator));
             }
         }
 
         return dest;
     }
 
+    /**
+     * @brief Returns the exclusive or of the Zobrist keys of the machine arcs that start or end in any of two tasks,
+     * each arc counted once.
+     * 
+     * @param task1 first task.
+     * @param task2 second task.
+     * @return the exclusive or of the keys of the arcs.
+     */
+    std::uint64_t MachineArcsHash(const TaskType& task1, const TaskType& task2) const
+    {
+        std::uint64_t arcs = 0;
+        for (const TaskType& task: {std::cref(task1), std::cref(task2)}) {
+            const auto& metadata = disjunctive_graph.at(task);
+            if (metadata.machine_predecessor.has_value()) {
+                arcs ^= Zobrist::Arc(metadata.machine_predecessor->get().GetTaskID(), task.GetTaskID());
+            }
+            if (metadata.machine_successor.has_value() && metadata.machine_successor->get() != task1 && metadata.machine_successor->get() != task2) {
+                arcs ^= Zobrist::Arc(task.GetTaskID(), metadata.machine_successor->get().GetTaskID());
+            }
+        }
+        return arcs;
+    }
+
     /**
      * @brief Adds a task to the solution.
      * 
@@ -254,7 +347,7 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
     void AddTask(const TaskType& task)
     {
         disjunctive_graph.insert(std::make_pair(std::cref(task), TaskMetadata{}));
-        changes.insert(task);
+        MarkChanged(task);
     }
 
     /**
@@ -273,8 +366,8 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         }
         disjunctive_graph.at(from).job_successor = to;
         disjunctive_graph.at(to).job_predecessor = from;
-        changes.insert(from);
-        changes.insert(to);
+        MarkChanged(from);
+        MarkChanged(to);
     }
 
     /**
@@ -293,8 +386,9 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         }
         disjunctive_graph.at(from).machine_successor = to;
         disjunctive_graph.at(to).machine_predecessor = from;
-        changes.insert(from);
-        changes.insert(to);
+        hash ^= Zobrist::Arc(from.GetTaskID(), to.GetTaskID());
+        MarkChanged(from);
+        MarkChanged(to);
     }
 
     /**
@@ -310,8 +404,8 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         }
         disjunctive_graph.at(from).job_successor.reset();
         disjunctive_graph.at(to).job_predecessor.reset();
-        changes.insert(from);
-        changes.insert(to);
+        MarkChanged(from);
+        MarkChanged(to);
     }
 
     /**
@@ -327,8 +421,9 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         }
         disjunctive_graph.at(from).machine_successor.reset();
         disjunctive_graph.at(to).machine_predecessor.reset();
-        changes.insert(from);
-        changes.insert(to);
+        hash ^= Zobrist::Arc(from.GetTaskID(), to.GetTaskID());
+        MarkChanged(from);
+        MarkChanged(to);
     }
 
     /**
@@ -344,6 +439,7 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         if (task1.GetMachine() != task2.GetMachine()) {
             throw std::invalid_argument("Tasks do not belong to the same machine");
         }
+        hash ^= MachineArcsHash(task1, task2);
         auto predecessor1 = disjunctive_graph.at(task1).machine_predecessor;
         auto predecessor2 = disjunctive_graph.at(task2).machine_predecessor;
         auto successor1 = disjunctive_graph.at(task1).machine_successor;
@@ -363,8 +459,9 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         }
         std::swap(disjunctive_graph.at(task1).machine_predecessor, disjunctive_graph.at(task2).machine_predecessor);
         std::swap(disjunctive_graph.at(task1).machine_successor, disjunctive_graph.at(task2).machine_successor);
-        changes.insert(task1);
-        changes.insert(task2);
+        hash ^= MachineArcsHash(task1, task2);
+        MarkChanged(task1);
+        MarkChanged(task2);
     }
 
     /**
@@ -375,11 +472,8 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
      */
     template <typename Move> void ApplyMove(const Move& move)
     {
-        std::vector<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> changes;
-        move.GetChanges(std::back_inserter(changes));
-        for (const auto& [from, to]: changes) {
-            ExchangeTasks(from, to);
-        }
+        JSP_SCOPED_TIMER(Probe::ApplyMove);
+        move.ForEachChange([this](const TaskType& from, const TaskType& to) { ExchangeTasks(from, to); });
     }
 
     /**
@@ -623,36 +717,60 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
         return ss.str();
     }
 
+    /**
+     * @brief Returns the Zobrist hash of the machine orders, which is updated with each change of the orders.
+     * Equal solutions have equal hashes.
+     * 
+     * @return the Zobrist hash of the machine orders.
+     */
+    std::uint64_t GetHash() const
+    {
+        return hash;
+    }
+
+    /**
+     * @brief Checks if two solutions have the same machine orders, and then the same schedule. The hashes are compared
+     * first, so different solutions are almost always told apart in constant time.
+     * 
+     */
     bool operator==(const JSPMakespanMinimizationSolution& other) const
     {
-        UpdateHeadsAndTails();
-        return disjunctive_graph == other.disjunctive_graph;
+        if (hash != other.hash) {
+            return false;
+        }
+        for (const auto& [task, metadata]: disjunctive_graph) {
+            const auto& successor = other.disjunctive_graph.at(task).machine_successor;
+            if (metadata.machine_successor.has_value() != successor.has_value() ||
+                (successor.has_value() && metadata.machine_successor->get() != successor->get())) {
+                return false;
+            }
+        }
+        return true;
     };
 
     bool operator!=(const JSPMakespanMinimizationSolution& other) const
     {
-        UpdateHeadsAndTails();
-        return disjunctive_graph != other.disjunctive_graph;
+        return !(*this == other);
     };
 
     bool operator<(const JSPMakespanMinimizationSolution& other) const
     {
-        return GetQuality() < other.GetQuality();
+        return GetObjective() > other.GetObjective();
     };
 
     bool operator>(const JSPMakespanMinimizationSolution& other) const
     {
-        return GetQuality() > other.GetQuality();
+        return GetObjective() < other.GetObjective();
     };
 
     bool operator<=(const JSPMakespanMinimizationSolution& other) const
     {
-        return GetQuality() <= other.GetQuality();
+        return GetObjective() >= other.GetObjective();
     };
 
     bool operator>=(const JSPMakespanMinimizationSolution& other) const
     {
-        return GetQuality() >= other.GetQuality();
+        return GetObjective() <= other.GetObjective();
     };
 
     friend std::ostream& operator<<(std::ostream& os, const JSPMakespanMinimizationSolution& sol)
@@ -661,4 +779,15 @@ template <typename Problem, typename Tails = std::false_type> class JSPMakespanM
     }
 };
 
+namespace std
+{
+    template <typename Problem, typename Tails> struct hash<JSPMakespanMinimizationSolution<Problem, Tails>>
+    {
+        size_t operator()(const JSPMakespanMinimizationSolution<Problem, Tails>& k) const
+        {
+            return static_cast<size_t>(k.GetHash());
+        }
+    };
+}
+
 #endif /* JSPMAKESPANMINIMIZATIONSOLUTION_HPP_ */
@@ -11,10 +11,20 @@
 #ifndef JSPMOVE_HPP_
 #define JSPMOVE_HPP_
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
 /**
- * @brief Move in a JSP.
+ * @brief Move in a JSP. The changes are kept with the identifiers of their tasks, which are the only thing compared by
+ * the equality and combined in the hash, and the hash is cached, so checking the tabu list costs a few integer comparisons.
+ * Up to two changes (every CET move and most CEI moves) are stored inline; longer moves are stored in a vector that is
+ * allocator-aware, so the moves of an iteration of a search can be allocated in an arena (see MonotonicArena); their
+ * copies use the default resource.
  * 
  * @tparam Problem type of the problem.
  */
@@ -26,9 +36,84 @@ template <typename Problem> class JSPMove
     using TaskType = typename ProblemType::TaskType;
 
   private:
-    std::vector<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> changes;
+    /**
+     * @brief Exchange of two tasks.
+     * 
+     */
+    struct Change
+    {
+        const TaskType* from = nullptr; // task that is scheduled before and will be scheduled after
+        const TaskType* to = nullptr; // task that is scheduled after and will be scheduled before
+        unsigned int from_id = 0; // identifier of from
+        unsigned int to_id = 0; // identifier of to
+    };
 
   public:
+    using allocator_type = std::pmr::polymorphic_allocator<Change>;
+
+  private:
+    static constexpr std::size_t inline_capacity = 2; // number of changes that are stored inline
+
+    std::array<Change, inline_capacity> inline_changes; // changes while there are at most inline_capacity
+    std::pmr::vector<Change> changes; // all the changes when there are more than inline_capacity
+    std::size_t size = 0; // number of changes
+    std::size_t hash = 0; // hash of the changes
+
+    const Change* Begin() const
+    {
+        return size <= inline_capacity ? inline_changes.data() : changes.data();
+    }
+
+    Change* Begin()
+    {
+        return size <= inline_capacity ? inline_changes.data() : changes.data();
+    }
+
+    static std::size_t Combine(std::size_t seed, const Change& change)
+    {
+        return seed ^ (change.from_id + 0x9e3779b9 + (seed << 6) + (seed >> 2)) ^ (change.to_id + 0x7f4a7c15 + (seed << 12) + (seed >> 4));
+    }
+
+  public:
+    JSPMove() = default;
+    JSPMove(const JSPMove&) = default;
+    JSPMove(JSPMove&&) = default;
+    JSPMove& operator=(const JSPMove&) = default;
+    JSPMove& operator=(JSPMove&&) = default;
+
+    /**
+     * @brief Constructs a new empty JSPMove that allocates with the given allocator.
+     * 
+     * @param allocator allocator of the move.
+     */
+    explicit JSPMove(const allocator_type& allocator) : changes(allocator) {}
+
+    /**
+     * @brief Constructs a copy of a JSPMove that allocates with the given allocator.
+     * 
+     * @param other move to be copied.
+     * @param allocator allocator of the move.
+     */
+    JSPMove(const JSPMove& other, const allocator_type& allocator) :
+        inline_changes{other.inline_changes},
+        changes(other.changes, allocator),
+        size{other.size},
+        hash{other.hash}
+    {}
+
+    /**
+     * @brief Constructs a JSPMove with the changes of another move, allocating with the given allocator.
+     * 
+     * @param other move whose changes are moved.
+     * @param allocator allocator of the move.
+     */
+    JSPMove(JSPMove&& other, const allocator_type& allocator) :
+        inline_changes{other.inline_changes},
+        changes(std::move(other.changes), allocator),
+        size{other.size},
+        hash{other.hash}
+    {}
+
     /**
      * @brief Adds a change to the move.
      * 
@@ -37,7 +122,17 @@ template <typename Problem> class JSPMove
      */
     void AddChange(const TaskType& from, const TaskType& to)
     {
-        changes.push_back(std::make_pair(std::cref(from), std::cref(to)));
+        Change change{&from, &to, from.GetTaskID(), to.GetTaskID()};
+        if (size < inline_capacity) {
+            inline_changes[size] = change;
+        } else {
+            if (size == inline_capacity) {
+                changes.assign(inline_changes.begin(), inline_changes.end());
+            }
+            changes.push_back(change);
+        }
+        size++;
+        hash = Combine(hash, change);
     }
 
     /**
@@ -47,8 +142,14 @@ template <typename Problem> class JSPMove
      */
     JSPMove& Invert()
     {
-        std::for_each(changes.begin(), changes.end(), [](auto& pair) { std::swap(pair.first, pair.second); });
-        std::reverse(changes.begin(), changes.end());
+        Change* first = Begin();
+        std::for_each(first, first + size, [](Change& change) {
+            std::swap(change.from, change.to);
+            std::swap(change.from_id, change.to_id);
+        });
+        std::reverse(first, first + size);
+        hash = 0;
+        std::for_each(first, first + size, [this](const Change& change) { hash = Combine(hash, change); });
         return *this;
     }
 
@@ -61,19 +162,32 @@ template <typename Problem> class JSPMove
      */
     template <typename Iter> Iter GetChanges(Iter dest) const
     {
-        return std::copy(changes.begin(), changes.end(), dest);
+        return std::transform(Begin(), Begin() + size, dest, [](const Change& change) {
+            return std::make_pair(std::cref(*change.from), std::cref(*change.to));
+        });
+    }
+
+    /**
+     * @brief Calls a function with the tasks of each change, without copying them.
+     * 
+     * @tparam Function type of the function to be called.
+     * @param function function to be called with the task scheduled before and the task scheduled after of each change.
+     */
+    template <typename Function> void ForEachChange(Function function) const
+    {
+        std::for_each(Begin(), Begin() + size, [&function](const Change& change) { function(*change.from, *change.to); });
     }
 
     bool operator==(const JSPMove& other) const
     {
-        return distance(changes.begin(), changes.end()) == distance(other.changes.begin(), other.changes.end()) &&
-               equal(changes.begin(), changes.end(), other.changes.begin(), std::equal_to<std::pair<TaskType, TaskType>>());
+        return size == other.size && hash == other.hash && std::equal(Begin(), Begin() + size, other.Begin(), [](const Change& a, const Change& b) {
+                   return a.from_id == b.from_id && a.to_id == b.to_id;
+               });
     }
 
     bool operator!=(const JSPMove& other) const
     {
-        return distance(changes.begin(), changes.end()) != distance(other.changes.begin(), other.changes.end()) ||
-               !equal(changes.begin(), changes.end(), other.changes.begin(), std::equal_to<std::pair<TaskType, TaskType>>());
+        return !(*this == other);
     }
 };
 
@@ -83,12 +197,7 @@ namespace std
     {
         size_t operator()(const JSPMove<Problem>& k) const
         {
-            std::size_t seed = k.changes.size();
-            for (auto& e: k.changes) {
-                seed ^= std::hash<typename JSPMove<Problem>::TaskType>{}(e.first) ^
-                        (std::hash<typename JSPMove<Problem>::TaskType>{}(e.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
-            }
-            return seed;
+            return k.hash;
         }
     };
 }
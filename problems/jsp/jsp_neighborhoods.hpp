@@ -12,6 +12,10 @@
 #define JSPNEIGHBORHOODS_HPP_
 
 #include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -20,6 +24,7 @@
 #include <problems/jsp/jsp_move.hpp>
 #include <problems/jsp/jsp_restriction_list.hpp>
 #include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <utils/objective_key.hpp>
 #include <utils/template_utils.hpp>
 
 /**
@@ -33,6 +38,7 @@
  * @param solution solution for which the estimate will be calculated.
  * @param before task that is scheduled in the same machine before the first task in the group.
  * @param after task that is scheduled in the same machine after the last task in the group.
+ * @param resource memory resource of the temporary containers.
  * @return estimate of the makespan for the new order of the tasks. 
  */
 template <typename Iter, typename Solution>
@@ -40,36 +46,42 @@ static typename Solution::TimeType EstimateMakespan(Iter first,
                                                     Iter last,
                                                     const Solution& solution,
                                                     const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& before,
-                                                    const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& after)
+                                                    const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& after,
+                                                    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
 {
     using TaskType = typename Solution::TaskType;
     using TimeType = typename Solution::TimeType;
-    //estimate heads
-    std::unordered_map<std::reference_wrapper<const TaskType>, TimeType, std::hash<TaskType>, std::equal_to<TaskType>> heads;
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    //estimate heads (of the tasks in the new order)
+    std::pmr::vector<TimeType> heads(size, resource);
     std::optional<std::reference_wrapper<const TaskType>> job_predecessor = solution.GetPrevPrecedenceConstrainedTask(*first);
-    heads[*first] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
-                             before.has_value() ? solution.GetHead(*before) + before->get().GetDuration() : TimeType{});
-    for (auto it = std::next(first); it != last; ++it) {
+    heads[0] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
+                        before.has_value() ? solution.GetHead(*before) + before->get().GetDuration() : TimeType{});
+    std::size_t i = 1;
+    for (auto it = std::next(first); it != last; ++it, ++i) {
         job_predecessor = solution.GetPrevPrecedenceConstrainedTask(*it);
-        heads[*it] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
-                              heads[*std::prev(it)] + std::prev(it)->get().GetDuration());
+        heads[i] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
+                            heads[i - 1] + std::prev(it)->get().GetDuration());
     }
 
     //estimate tails
-    std::unordered_map<std::reference_wrapper<const TaskType>, TimeType, std::hash<TaskType>, std::equal_to<TaskType>> tails;
+    std::pmr::vector<TimeType> tails(size, resource);
     std::optional<std::reference_wrapper<const TaskType>> job_successor = solution.GetNextPrecedenceConstrainedTask(*std::prev(last));
-    tails[*std::prev(last)] = std::max(job_successor.has_value() ? solution.GetTail(*job_successor) + job_successor->get().GetDuration() : TimeType{},
-                                       after.has_value() ? solution.GetTail(*after) + after->get().GetDuration() : TimeType{});
+    tails[size - 1] = std::max(job_successor.has_value() ? solution.GetTail(*job_successor) + job_successor->get().GetDuration() : TimeType{},
+                               after.has_value() ? solution.GetTail(*after) + after->get().GetDuration() : TimeType{});
+    i = size - 1;
     for (auto it = std::prev(last); it-- != first;) {
+        i--;
         job_successor = solution.GetNextPrecedenceConstrainedTask(*it);
-        tails[*it] = std::max(job_successor.has_value() ? solution.GetTail(*job_successor) + job_successor->get().GetDuration() : TimeType{},
-                              tails[*std::next(it)] + std::next(it)->get().GetDuration());
+        tails[i] = std::max(job_successor.has_value() ? solution.GetTail(*job_successor) + job_successor->get().GetDuration() : TimeType{},
+                            tails[i + 1] + std::next(it)->get().GetDuration());
     }
 
     //estimate makespan
     TimeType makespan{};
-    for (auto it = first; it != last; ++it) {
-        makespan = std::max(makespan, heads[*it] + it->get().GetDuration() + tails[*it]);
+    i = 0;
+    for (auto it = first; it != last; ++it, ++i) {
+        makespan = std::max(makespan, heads[i] + it->get().GetDuration() + tails[i]);
     }
     return makespan;
 }
@@ -85,6 +97,7 @@ static typename Solution::TimeType EstimateMakespan(Iter first,
  * @param solution solution for which the estimate will be calculated.
  * @param before task that is scheduled in the same machine before the first task in the group.
  * @param after task that is scheduled in the same machine after the last task in the group.
+ * @param resource memory resource of the temporary containers.
  * @return estimate of the total weighted tardiness for the new order of the tasks. 
  */
 template <typename Iter, typename Solution>
@@ -93,41 +106,47 @@ EstimateTotalWeightedTardiness(Iter first,
                                Iter last,
                                const Solution& solution,
                                const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& before,
-                               const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& after)
+                               const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& after,
+                               std::pmr::memory_resource* resource = std::pmr::get_default_resource())
 {
     using TaskType = typename Solution::TaskType;
     using TimeType = typename Solution::TimeType;
     using JobType = typename Solution::JobType;
-    //estimate heads
-    std::unordered_map<std::reference_wrapper<const TaskType>, TimeType, std::hash<TaskType>, std::equal_to<TaskType>> heads;
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    //estimate heads (of the tasks in the new order)
+    std::pmr::vector<TimeType> heads(size, resource);
     std::optional<std::reference_wrapper<const TaskType>> job_predecessor = solution.GetPrevPrecedenceConstrainedTask(*first);
-    heads[*first] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
-                             before.has_value() ? solution.GetHead(*before) + before->get().GetDuration() : TimeType{});
-    for (auto it = std::next(first); it != last; ++it) {
+    heads[0] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
+                        before.has_value() ? solution.GetHead(*before) + before->get().GetDuration() : TimeType{});
+    std::size_t i = 1;
+    for (auto it = std::next(first); it != last; ++it, ++i) {
         job_predecessor = solution.GetPrevPrecedenceConstrainedTask(*it);
-        heads[*it] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
-                              heads[*std::prev(it)] + std::prev(it)->get().GetDuration());
+        heads[i] = std::max(job_predecessor.has_value() ? solution.GetHead(*job_predecessor) + job_predecessor->get().GetDuration() : TimeType{},
+                            heads[i - 1] + std::prev(it)->get().GetDuration());
     }
 
     //estimate tails
-    std::vector<std::reference_wrapper<const JobType>> jobs;
+    std::pmr::vector<std::reference_wrapper<const JobType>> jobs(resource);
     solution.GetProblem().GetJobs(std::back_inserter(jobs));
+    std::pmr::vector<TimeType> tails(size, resource);
     TimeType twt{};
     for (const JobType& job: jobs) {
-        std::unordered_map<std::reference_wrapper<const TaskType>, TimeType, std::hash<TaskType>, std::equal_to<TaskType>> tails;
         std::optional<std::reference_wrapper<const TaskType>> job_successor = solution.GetNextPrecedenceConstrainedTask(*std::prev(last));
-        tails[*std::prev(last)] =
+        tails[size - 1] =
             std::max(job_successor.has_value() ? solution.GetTail(*job_successor, job) + job_successor->get().GetDuration() : TimeType{},
                      after.has_value() ? solution.GetTail(*after, job) + after->get().GetDuration() : TimeType{});
+        i = size - 1;
         for (auto it = std::prev(last); it-- != first;) {
+            i--;
             job_successor = solution.GetNextPrecedenceConstrainedTask(*it);
-            tails[*it] = std::max(job_successor.has_value() ? solution.GetTail(*job_successor, job) + job_successor->get().GetDuration() : TimeType{},
-                                  tails[*std::next(it)] + std::next(it)->get().GetDuration());
+            tails[i] = std::max(job_successor.has_value() ? solution.GetTail(*job_successor, job) + job_successor->get().GetDuration() : TimeType{},
+                                tails[i + 1] + std::next(it)->get().GetDuration());
         }
 
         TimeType tardiness{};
-        for (auto it = first; it != last; ++it) {
-            tardiness = std::max(tardiness, heads[*it] + it->get().GetDuration() + tails[*it]);
+        i = 0;
+        for (auto it = first; it != last; ++it, ++i) {
+            tardiness = std::max(tardiness, heads[i] + it->get().GetDuration() + tails[i]);
         }
         twt += std::max(TimeType{}, tardiness - job.GetDueDate()) * job.GetWeight();
     }
@@ -136,7 +155,7 @@ EstimateTotalWeightedTardiness(Iter first,
 }
 
 /**
- * @brief Returns the quality that results of changing the order
+ * @brief Returns the objective (the key that ranks the solutions) that results of changing the order
  * of a group of tasks in the same machine.
  * 
  * @tparam Estimate if true an estimate will be used.
@@ -144,33 +163,41 @@ EstimateTotalWeightedTardiness(Iter first,
  * @tparam Move type of the move.
  * @tparam Iter type of the iterator to be used to read the group of tasks.
  * @param solution solution to be considered.
+ * @param copy copy of the solution where the move is applied if the objective is not estimated, made on the first call.
  * @param move move to be applied.
  * @param first iterator pointing to the first task in the new order.
  * @param last iterator pointing to the task past the last task in the new order.
  * @param before task that is scheduled in the same machine before the first task in the group.
  * @param after task that is scheduled in the same machine after the last task in the group.
- * @return quality for the new order of the tasks.  
+ * @param resource memory resource of the temporary containers of the estimates.
+ * @return objective for the new order of the tasks.  
  */
 template <typename Estimate, typename Solution, typename Move, typename Iter>
-static double GetQuality(Solution& solution,
-                         Move& move,
-                         [[maybe_unused]] Iter first,
-                         [[maybe_unused]] Iter last,
-                         const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& before,
-                         const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& after)
+static typename Solution::ObjectiveType
+GetObjective(const Solution& solution,
+             [[maybe_unused]] std::optional<Solution>& copy,
+             [[maybe_unused]] Move& move,
+             [[maybe_unused]] Iter first,
+             [[maybe_unused]] Iter last,
+             [[maybe_unused]] const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& before,
+             [[maybe_unused]] const std::optional<std::reference_wrapper<const typename Solution::TaskType>>& after,
+             [[maybe_unused]] std::pmr::memory_resource* resource)
 {
     if constexpr (Estimate::value) {
         if constexpr (is_specialization<Solution, JSPMakespanMinimizationSolution>::value) {
-            return 1.0 / EstimateMakespan(first, last, solution, before, after);
+            return ObjectiveKey<typename Solution::TimeType>::Get(EstimateMakespan(first, last, solution, before, after, resource));
         } else if constexpr (is_specialization<Solution, JSPTotalWeightedTardinessMinimizationSolution>::value) {
-            return 1.0 / EstimateTotalWeightedTardiness(first, last, solution, before, after);
+            return ObjectiveKey<typename Solution::TimeType>::Get(EstimateTotalWeightedTardiness(first, last, solution, before, after, resource));
         }
     } else {
-        solution.ApplyMove(move);
-        auto quality = solution.GetQuality();
-        solution.ApplyMove(move.Invert());
+        if (!copy.has_value()) {
+            copy.emplace(solution);
+        }
+        copy->ApplyMove(move);
+        auto objective = copy->GetObjective();
+        copy->ApplyMove(move.Invert());
         move.Invert();
-        return quality;
+        return objective;
     }
 }
 
@@ -196,39 +223,45 @@ template <typename Problem, template <typename> class Move = JSPMove, typename E
      * @tparam Solution type of the solution whose neighbors will be calculated.
      * @param dest iterator to be used to insert the neighbors.
      * @param solution solution whose neighbors will be calculated.
+     * @param resource memory resource of the moves and of the temporary containers.
      * @return an iterator to the neighbor past the last neighbor inserted. 
      */
-    template <typename Iter, typename Solution> static Iter GetNeighbors(Iter dest, const Solution& solution)
+    template <typename Iter, typename Solution>
+    static Iter GetNeighbors(Iter dest, const Solution& solution, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     {
-        std::vector<BlockType> critical_blocks;
-        solution.template GetCriticalBlocks<BlockType>(std::back_inserter(critical_blocks));
-        Solution copy(solution);
+        std::pmr::vector<BlockType> critical_blocks(resource);
+        solution.template GetCriticalBlocks<BlockType>(std::back_inserter(critical_blocks), resource);
+        std::optional<Solution> copy;
         for (const auto& block: critical_blocks) {
-            std::deque<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> edges;
+            std::pmr::deque<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> edges(resource);
             block.GetRestrictions(std::back_inserter(edges));
             auto edge = edges.front();
-            MoveType move;
+            MoveType move(resource);
             move.AddChange(edge.first, edge.second);
-            std::vector<std::reference_wrapper<const TaskType>> new_order = {edge.second, edge.first};
-            *dest++ = MoveData(move,
-                               GetQuality<Estimate>(copy,
+            std::pmr::vector<std::reference_wrapper<const TaskType>> new_order({edge.second, edge.first}, resource);
+            auto objective = GetObjective<Estimate>(solution,
+                                                    copy,
                                                     move,
                                                     new_order.begin(),
                                                     new_order.end(),
                                                     solution.GetPrevCapacityConstrainedTask(edge.first),
-                                                    solution.GetNextCapacityConstrainedTask(edge.second)));
+                                                    solution.GetNextCapacityConstrainedTask(edge.second),
+                                                    resource);
+            *dest++ = MoveData(std::move(move), objective);
             if (block.GetNumberRestrictions() > 1) {
                 edge = edges.back();
-                move = MoveType{};
+                move = MoveType(resource);
                 move.AddChange(edge.first, edge.second);
-                std::vector<std::reference_wrapper<const TaskType>> new_order = {edge.second, edge.first};
-                *dest++ = MoveData(move,
-                                   GetQuality<Estimate>(copy,
-                                                        move,
-                                                        new_order.begin(),
-                                                        new_order.end(),
-                                                        solution.GetPrevCapacityConstrainedTask(edge.first),
-                                                        solution.GetNextCapacityConstrainedTask(edge.second)));
+                new_order = {edge.second, edge.first};
+                objective = GetObjective<Estimate>(solution,
+                                                   copy,
+                                                   move,
+                                                   new_order.begin(),
+                                                   new_order.end(),
+                                                   solution.GetPrevCapacityConstrainedTask(edge.first),
+                                                   solution.GetNextCapacityConstrainedTask(edge.second),
+                                                   resource);
+                *dest++ = MoveData(std::move(move), objective);
             }
         }
         return dest;
@@ -268,21 +301,23 @@ template <typename Problem, template <typename> class Move = JSPMove, typename E
      * @tparam Solution type of the solution whose neighbors will be calculated.
      * @param dest iterator to be used to insert the neighbors.
      * @param solution solution whose neighbors will be calculated.
+     * @param resource memory resource of the moves and of the temporary containers.
      * @return an iterator to the neighbor past the last neighbor inserted. 
      */
-    template <typename Iter, typename Solution> static Iter GetNeighbors(Iter dest, const Solution& solution)
+    template <typename Iter, typename Solution>
+    static Iter GetNeighbors(Iter dest, const Solution& solution, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     {
-        std::vector<BlockType> critical_blocks;
-        solution.template GetCriticalBlocks<BlockType>(std::back_inserter(critical_blocks));
-        Solution copy(solution);
+        std::pmr::vector<BlockType> critical_blocks(resource);
+        solution.template GetCriticalBlocks<BlockType>(std::back_inserter(critical_blocks), resource);
+        std::optional<Solution> copy;
 
         for (const auto& block: critical_blocks) {
-            std::deque<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> edges;
+            std::pmr::deque<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> edges(resource);
             block.GetRestrictions(std::back_inserter(edges));
             // shift the operations at the end
             for (auto it1 = edges.begin(); it1 != edges.end(); ++it1) {
-                MoveType move;
-                std::deque<std::reference_wrapper<const TaskType>> new_order;
+                MoveType move(resource);
+                std::pmr::deque<std::reference_wrapper<const TaskType>> new_order(resource);
                 auto successor = solution.GetNextPrecedenceConstrainedTask(it1->first);
                 auto completion_time =
                     successor.has_value() ? solution.GetHead(successor.value()) + successor.value().get().GetDuration() : TimeType{};
@@ -298,19 +333,21 @@ template <typename Problem, template <typename> class Move = JSPMove, typename E
                 }
                 if (!new_order.empty()) {
                     new_order.push_back(it1->first);
-                    *dest++ = MoveData(move,
-                                       GetQuality<Estimate>(copy,
+                    auto objective = GetObjective<Estimate>(solution,
+                                                            copy,
                                                             move,
                                                             new_order.begin(),
                                                             new_order.end(),
                                                             solution.GetPrevCapacityConstrainedTask(new_order.at(new_order.size() - 1)),
-                                                            solution.GetNextCapacityConstrainedTask(new_order.at(new_order.size() - 2))));
+                                                            solution.GetNextCapacityConstrainedTask(new_order.at(new_order.size() - 2)),
+                                                            resource);
+                    *dest++ = MoveData(std::move(move), objective);
                 }
             }
             // shift the operations at the beginning
             for (auto it1 = edges.rbegin(); it1 != edges.rend(); ++it1) {
-                MoveType move;
-                std::deque<std::reference_wrapper<const TaskType>> new_order;
+                MoveType move(resource);
+                std::pmr::deque<std::reference_wrapper<const TaskType>> new_order(resource);
                 auto predecessor = solution.GetPrevPrecedenceConstrainedTask(it1->second);
                 auto head = predecessor.has_value() ? solution.GetHead(predecessor.value()) : TimeType{};
 
@@ -326,13 +363,15 @@ template <typename Problem, template <typename> class Move = JSPMove, typename E
                 }
                 if (!new_order.empty()) {
                     new_order.push_front(it1->second);
-                    *dest++ = MoveData(move,
-                                       GetQuality<Estimate>(copy,
+                    auto objective = GetObjective<Estimate>(solution,
+                                                            copy,
                                                             move,
                                                             new_order.begin(),
                                                             new_order.end(),
                                                             solution.GetPrevCapacityConstrainedTask(new_order.at(1)),
-                                                            solution.GetNextCapacityConstrainedTask(new_order.at(0))));
+                                                            solution.GetNextCapacityConstrainedTask(new_order.at(0)),
+                                                            resource);
+                    *dest++ = MoveData(std::move(move), objective);
                 }
             }
         }
@@ -0,0 +1,307 @@
+/**
+ * @file jsp_path_relinking.hpp
+ * @author Pablo
+ * @brief Path relinking for JSP in the space of the disjunctive graphs.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef JSPPATHRELINKING_HPP_
+#define JSPPATHRELINKING_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp_genetic_encoders.hpp>
+#include <problems/jsp/jsp_move.hpp>
+#include <problems/jsp/jsp_schedule_generation_schemes.hpp>
+#include <utils/instrumentation.hpp>
+#include <utils/objective_key.hpp>
+
+/**
+ * @brief Path relinking for JSP. It walks from the machine orders of a solution (the initiating solution) towards the machine
+ * orders of another solution (the guiding solution) exchanging adjacent tasks of a machine that are in the opposite order in
+ * the guiding solution, so each step reduces the distance (the number of pairs of tasks of the same machine in different order)
+ * in one. At each step some of those exchanges are evaluated with the incremental update of the heads, the best one is applied,
+ * and the best solution of the path far enough from both ends is returned.
+ * 
+ * It can also be used as the crossover operator of the evolutionary algorithms: the parents are decoded keeping the order
+ * of their genes, and the offsprings are the encodings of the best solutions of the paths between them in both directions.
+ * 
+ * @tparam Solution type of the solutions.
+ */
+template <typename Solution> class JSPPathRelinking
+{
+  public:
+    using ProblemType = typename Solution::ProblemType;
+    using TaskType = typename Solution::TaskType;
+    using MachineType = typename Solution::MachineType;
+    using TimeType = typename Solution::TimeType;
+
+  private:
+    using TaskMap = std::unordered_map<std::reference_wrapper<const TaskType>, std::size_t, std::hash<TaskType>, std::equal_to<TaskType>>;
+
+    std::reference_wrapper<const ProblemType> problem; // problem to which the chromosomes belong
+    std::reference_wrapper<SearchBudget> budget; // budget where the evaluations of the crossovers are counted
+    unsigned int candidates; // exchanges evaluated at each step
+    double margin; // minimum distance of the returned solution to both ends, relative to the length of the path
+
+    /**
+     * @brief Returns the tasks of each machine in the order in which they are processed.
+     * 
+     * @param solution solution.
+     * @return the tasks of each machine in the order in which they are processed.
+     */
+    static std::vector<std::vector<std::reference_wrapper<const TaskType>>> GetMachineSequences(const Solution& solution)
+    {
+        std::vector<std::reference_wrapper<const MachineType>> machines;
+        solution.GetProblem().GetMachines(std::back_inserter(machines));
+        std::vector<std::vector<std::reference_wrapper<const TaskType>>> sequences;
+        for (const MachineType& machine: machines) {
+            std::vector<std::reference_wrapper<const TaskType>> tasks;
+            solution.GetProblem().GetMachineTasks(std::back_inserter(tasks), machine.GetMachineID());
+            std::vector<std::reference_wrapper<const TaskType>> sequence;
+            std::optional<std::reference_wrapper<const TaskType>> task;
+            for (const TaskType& t: tasks) {
+                if (!solution.GetPrevCapacityConstrainedTask(t).has_value()) {
+                    task = t;
+                }
+            }
+            while (task.has_value()) {
+                sequence.push_back(*task);
+                task = solution.GetNextCapacityConstrainedTask(*task);
+            }
+            sequences.push_back(std::move(sequence));
+        }
+        return sequences;
+    }
+
+    /**
+     * @brief Returns the position of each task in its machine.
+     * 
+     * @param sequences tasks of each machine in the order in which they are processed.
+     * @return the position of each task in its machine.
+     */
+    static TaskMap GetPositions(const std::vector<std::vector<std::reference_wrapper<const TaskType>>>& sequences)
+    {
+        TaskMap positions;
+        for (const auto& sequence: sequences) {
+            for (std::size_t i = 0; i < sequence.size(); i++) {
+                positions[sequence[i]] = i;
+            }
+        }
+        return positions;
+    }
+
+    /**
+     * @brief Returns the number of pairs of tasks of the same machine whose order differs from the given positions.
+     * 
+     * @param sequences tasks of each machine in the order in which they are processed.
+     * @param positions position of each task in its machine in the other solution.
+     * @return the number of pairs of tasks in different order.
+     */
+    static std::size_t CountInversions(const std::vector<std::vector<std::reference_wrapper<const TaskType>>>& sequences, const TaskMap& positions)
+    {
+        std::size_t inversions = 0;
+        for (const auto& sequence: sequences) {
+            for (std::size_t i = 0; i < sequence.size(); i++) {
+                for (std::size_t j = i + 1; j < sequence.size(); j++) {
+                    inversions += positions.at(sequence[i]) > positions.at(sequence[j]);
+                }
+            }
+        }
+        return inversions;
+    }
+
+    /**
+     * @brief Checks if exchanging two adjacent tasks of a machine keeps the schedule feasible. The exchange creates a cycle
+     * only if there is a path from the first task to the second one through the job successor of the first task, and then
+     * the head of the second task is not lower than the head of that successor plus its duration. The ranking keys of the times
+     * are used, so the check is exact for crisp times and sound for fuzzy times, whose ranking is additive and monotone.
+     * 
+     * @param solution solution.
+     * @param first task processed first.
+     * @param second task processed right after the first one.
+     * @return true if the exchange is known to keep the schedule feasible.
+     */
+    static bool IsFeasibleExchange(const Solution& solution, const TaskType& first, const TaskType& second)
+    {
+        auto successor = solution.GetNextPrecedenceConstrainedTask(first);
+        if (!successor.has_value()) {
+            return true;
+        }
+        return ObjectiveKey<TimeType>::Get(solution.GetHead(*successor)) + ObjectiveKey<TimeType>::Get(successor->get().GetDuration()) >
+               ObjectiveKey<TimeType>::Get(solution.GetHead(second));
+    }
+
+  public:
+    /**
+     * @brief Constructs a new JSPPathRelinking to be used as a crossover operator.
+     * 
+     * @param problem problem to which the chromosomes belong.
+     * @param budget budget where the evaluations of the intermediate solutions are counted.
+     * @param candidates exchanges evaluated at each step of the paths.
+     * @param margin minimum distance of the returned solutions to both parents, relative to the distance between the parents.
+     */
+    JSPPathRelinking(const ProblemType& problem, SearchBudget& budget, unsigned int candidates = 8, double margin = 0.25) :
+        problem{problem},
+        budget{budget},
+        candidates{candidates == 0 ? 1 : candidates},
+        margin{margin}
+    {}
+
+    /**
+     * @brief Returns the distance between two solutions: the number of pairs of tasks of the same machine that are processed
+     * in different order.
+     * 
+     * @param solution1 first solution.
+     * @param solution2 second solution.
+     * @return the distance between the solutions.
+     */
+    static std::size_t Distance(const Solution& solution1, const Solution& solution2)
+    {
+        return CountInversions(GetMachineSequences(solution1), GetPositions(GetMachineSequences(solution2)));
+    }
+
+    /**
+     * @brief Walks from a solution towards another solution and returns the best solution of the path whose distance
+     * to both ends is at least the given fraction of the length of the path (and at least one).
+     * 
+     * @tparam RNG type of the random number generator.
+     * @param budget budget that limits the evaluations, each evaluated exchange counts as an evaluation.
+     * @param initiating solution where the path starts.
+     * @param guiding solution where the path ends.
+     * @param candidates exchanges evaluated at each step, chosen at random among the exchanges that reduce the distance.
+     * @param margin minimum distance of the returned solution to both ends, relative to the length of the path.
+     * @param rng random number generator.
+     * @return the best solution of the path far enough from both ends, or the initiating solution if the path is too short
+     * or the budget is exhausted before reaching any of them.
+     */
+    template <typename RNG>
+    static Solution Relink(SearchBudget& budget,
+                           const Solution& initiating,
+                           const Solution& guiding,
+                           unsigned int candidates,
+                           double margin,
+                           RNG& rng)
+    {
+        using MoveType = JSPMove<ProblemType>;
+
+        auto sequences = GetMachineSequences(initiating);
+        const auto target = GetPositions(GetMachineSequences(guiding));
+        const std::size_t length = CountInversions(sequences, target);
+        const auto gap = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(margin * length)));
+
+        Solution current(initiating);
+        std::optional<Solution> best;
+        // exchanges that reduce the distance, identified by their machine and the position of the first task
+        std::vector<std::pair<std::size_t, std::size_t>> exchanges;
+        for (std::size_t step = 1; step <= length && 2 * gap <= length && !budget.Exhausted(); step++) {
+            exchanges.clear();
+            for (std::size_t m = 0; m < sequences.size(); m++) {
+                for (std::size_t i = 0; i + 1 < sequences[m].size(); i++) {
+                    if (target.at(sequences[m][i]) > target.at(sequences[m][i + 1]) &&
+                        IsFeasibleExchange(current, sequences[m][i], sequences[m][i + 1])) {
+                        exchanges.emplace_back(m, i);
+                    }
+                }
+            }
+            if (exchanges.empty()) {
+                break;
+            }
+            // evaluate a random sample of the exchanges
+            std::size_t sample = std::min<std::size_t>(candidates, exchanges.size());
+            for (std::size_t k = 0; k < sample; k++) {
+                std::uniform_int_distribution<std::size_t> dis(k, exchanges.size() - 1);
+                std::swap(exchanges[k], exchanges[dis(rng)]);
+            }
+            std::size_t chosen = 0;
+            std::optional<typename Solution::ObjectiveType> chosen_objective;
+            for (std::size_t k = 0; k < sample; k++) {
+                const auto [m, i] = exchanges[k];
+                MoveType move;
+                move.AddChange(sequences[m][i], sequences[m][i + 1]);
+                current.ApplyMove(move);
+                auto objective = current.GetObjective();
+                current.ApplyMove(move.Invert());
+                if (!chosen_objective.has_value() || objective < *chosen_objective) {
+                    chosen = k;
+                    chosen_objective = objective;
+                }
+            }
+            budget.AddEvaluations(sample);
+            const auto [m, i] = exchanges[chosen];
+            MoveType move;
+            move.AddChange(sequences[m][i], sequences[m][i + 1]);
+            current.ApplyMove(move);
+            std::swap(sequences[m][i], sequences[m][i + 1]);
+            if (step >= gap && length - step >= gap && (!best.has_value() || current > *best)) {
+                best = current;
+            }
+        }
+        return best.has_value() ? *best : initiating;
+    }
+
+    /**
+     * @brief Inserts in a container the genes of the two offsprings resulting of crossing the specified parent chromosomes:
+     * the best solutions of the paths from the first parent to the second one and from the second parent to the first one.
+     * 
+     * @tparam InputIt1 type of the iterator to be used to read the first parent.
+     * @tparam InputIt2 type of the iterator to be used to read the second parent.
+     * @tparam OutputIt1 type of the iterator to be used to insert the genes of the first offspring.
+     * @tparam OutputIt2 type of the iterator to be used to insert the genes of the second offspring.
+     * @tparam RNG type of the random number generator.
+     * @param first1 iterator pointing to the first gene of the first parent.
+     * @param last1 iterator pointing to the gene past the last gene of the first parent.
+     * @param first2 iterator pointing to the first gene of the second parent.
+     * @param last2 iterator pointing to the gene past the last gene of the second parent.
+     * @param dest1 iterator to be used to insert the genes of the first offspring.
+     * @param dest2 iterator to be used to insert the genes of the second offspring.
+     * @param rng random number generator.
+     * @return a pair with the iterators pointing to the gene past the last gene inserted in each offspring.
+     */
+    template <typename InputIt1, typename InputIt2, typename OutputIt1, typename OutputIt2, typename RNG>
+    std::pair<OutputIt1, OutputIt2> Cross(InputIt1 first1,
+                                          InputIt1 last1,
+                                          InputIt2 first2,
+                                          InputIt2 last2,
+                                          OutputIt1 dest1,
+                                          OutputIt2 dest2,
+                                          RNG& rng) const
+    {
+        JSP_SCOPED_TIMER(Probe::Cross);
+        if (std::distance(first1, last1) != std::distance(first2, last2)) {
+            throw std::invalid_argument("Chromosomes don't have the same size");
+        }
+        // the machines process the tasks in the order of the genes
+        const auto decode = [this](auto first, auto last) {
+            std::vector<std::pair<std::reference_wrapper<const TaskType>, std::size_t>> priorities;
+            std::unordered_map<unsigned int, std::size_t> job_position;
+            for (std::size_t priority = 0; first != last; ++first, ++priority) {
+                priorities.emplace_back(problem.get().GetTask(*first, job_position[*first]++), priority);
+            }
+            return BuildSolution<Solution>(priorities.begin(), priorities.end(), problem.get());
+        };
+        Solution parent1 = decode(first1, last1);
+        Solution parent2 = decode(first2, last2);
+        auto offspring1 = Relink(budget, parent1, parent2, candidates, margin, rng);
+        auto offspring2 = Relink(budget, parent2, parent1, candidates, margin, rng);
+        auto end1 = PermutationWithRepetition<GT>::EncodeSolution(dest1, offspring1);
+        auto end2 = PermutationWithRepetition<GT>::EncodeSolution(dest2, offspring2);
+        return std::make_pair(end1, end2);
+    }
+};
+
+#endif /* JSPPATHRELINKING_HPP_ */
@@ -12,10 +12,14 @@
 #define JSPREADERS_HPP_
 
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <problems/jsp/jsp.hpp>
+#include <utils/mapped_file.hpp>
+#include <utils/text_scanner.hpp>
 
 /**
  * @brief Reads a JSP instance in standard format.
@@ -81,4 +85,79 @@ template <typename Task, typename Job, typename Machine> JSP<Task, Job, Machine>
     return jsp;
 }
 
+/**
+ * @brief Reads a JSP instance in standard format, with or without due dates, from a text buffer in a single forward pass.
+ * 
+ * @tparam Task type of the tasks.
+ * @tparam Job type of the jobs.
+ * @tparam Machine type of the machines.
+ * @param scanner scanner of the text buffer.
+ * @param due_dates true if each job starts with its due date and weight, false in other case.
+ * @return the problem read.
+ */
+template <typename Task, typename Job, typename Machine> JSP<Task, Job, Machine> read_standard_buffer(TextScanner& scanner, bool due_dates)
+{
+    JSP<Task, Job, Machine> jsp;
+    unsigned int jobs = scanner.Read<unsigned int>();
+    unsigned int machines = scanner.Read<unsigned int>();
+    jsp.Reserve(jobs, machines);
+    std::vector<bool> registered(machines, false); // machines already added to the problem
+    for (unsigned int j = 1; j <= jobs; j++) {
+        if (due_dates) {
+            auto due_date = scanner.Read<typename Job::DateType>();
+            auto weight = scanner.Read<double>();
+            jsp.AddJob(j, due_date, weight);
+        } else {
+            jsp.AddJob(j);
+        }
+        for (unsigned int m = 0; m < machines; m++) {
+            auto machine = scanner.Read<unsigned int>();
+            auto duration = scanner.Read<typename Task::TimeType>();
+            if (machine >= machines) {
+                throw std::invalid_argument("machine " + std::to_string(machine) + " out of range in job " + std::to_string(j));
+            }
+            if (!registered[machine]) {
+                jsp.AddMachine(machine + 1);
+                registered[machine] = true;
+            }
+            jsp.AddTask(j * machines + m + 1, j, machine + 1, duration);
+        }
+    }
+    return jsp;
+}
+
+/**
+ * @brief Reads a JSP instance in standard format from a file. The file is memory-mapped and parsed in place,
+ * which is much faster than read_standard for large instances. Fuzzy durations can be written as "(a,b,c)" or as crisp numbers.
+ * 
+ * @tparam Task type of the tasks.
+ * @tparam Job type of the jobs.
+ * @tparam Machine type of the machines.
+ * @param path path of the file.
+ * @return the problem read.
+ */
+template <typename Task, typename Job, typename Machine> JSP<Task, Job, Machine> read_standard_file(const std::string& path)
+{
+    MappedFile file(path);
+    TextScanner scanner(file.begin(), file.end());
+    return read_standard_buffer<Task, Job, Machine>(scanner, false);
+}
+
+/**
+ * @brief Reads a JSP instance with due dates in standard format from a file. The file is memory-mapped and parsed in place,
+ * which is much faster than read_standard_due_dates for large instances. Fuzzy durations can be written as "(a,b,c)" or as crisp numbers.
+ * 
+ * @tparam Task type of the tasks.
+ * @tparam Job type of the jobs.
+ * @tparam Machine type of the machines.
+ * @param path path of the file.
+ * @return the problem read.
+ */
+template <typename Task, typename Job, typename Machine> JSP<Task, Job, Machine> read_standard_due_dates_file(const std::string& path)
+{
+    MappedFile file(path);
+    TextScanner scanner(file.begin(), file.end());
+    return read_standard_buffer<Task, Job, Machine>(scanner, true);
+}
+
 #endif /* JSPREADERS_HPP_ */
\ No newline at end of file
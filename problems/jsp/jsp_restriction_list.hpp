@@ -12,9 +12,11 @@
 #define JSPRESTRICTIONLIST_HPP_
 
 #include <deque>
+#include <memory_resource>
 
 /**
- * @brief List that contains JSP restrictions (pairs of tasks).
+ * @brief List that contains JSP restrictions (pairs of tasks). It is allocator-aware, so the lists of an iteration of a
+ * search can be allocated in an arena (see MonotonicArena).
  * 
  * @tparam Problem type of the problem.
  */
@@ -23,11 +25,41 @@ template <typename Problem> class JSPRestrictionList
   public:
     using ProblemType = Problem;
     using TaskType = typename ProblemType::TaskType;
+    using allocator_type = std::pmr::polymorphic_allocator<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>>;
 
   private:
-    std::deque<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> restrictions;
+    std::pmr::deque<std::pair<std::reference_wrapper<const TaskType>, std::reference_wrapper<const TaskType>>> restrictions;
 
   public:
+    JSPRestrictionList() = default;
+    JSPRestrictionList(const JSPRestrictionList&) = default;
+    JSPRestrictionList(JSPRestrictionList&&) = default;
+    JSPRestrictionList& operator=(const JSPRestrictionList&) = default;
+    JSPRestrictionList& operator=(JSPRestrictionList&&) = default;
+
+    /**
+     * @brief Constructs a new empty JSPRestrictionList that allocates with the given allocator.
+     * 
+     * @param allocator allocator of the list.
+     */
+    explicit JSPRestrictionList(const allocator_type& allocator) : restrictions(allocator) {}
+
+    /**
+     * @brief Constructs a copy of a JSPRestrictionList that allocates with the given allocator.
+     * 
+     * @param other list to be copied.
+     * @param allocator allocator of the list.
+     */
+    JSPRestrictionList(const JSPRestrictionList& other, const allocator_type& allocator) : restrictions(other.restrictions, allocator) {}
+
+    /**
+     * @brief Constructs a JSPRestrictionList with the restrictions of another list, allocating with the given allocator.
+     * 
+     * @param other list whose restrictions are moved.
+     * @param allocator allocator of the list.
+     */
+    JSPRestrictionList(JSPRestrictionList&& other, const allocator_type& allocator) : restrictions(std::move(other.restrictions), allocator) {}
+
     /**
      * @brief Adds a restriction to the begining of the list.
      * 
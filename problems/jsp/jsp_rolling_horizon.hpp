@@ -0,0 +1,445 @@
+/**
+ * @file jsp_rolling_horizon.hpp
+ * @author Pablo
+ * @brief Rolling-horizon scheduling of a stream of JSP jobs.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef JSPROLLINGHORIZON_HPP_
+#define JSPROLLINGHORIZON_HPP_
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp_lower_bounds.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_solvers.hpp>
+#include <problems/jsp/jsp_warm_start.hpp>
+#include <utils/template_utils.hpp>
+
+/**
+ * @brief Scheduler of a JSP whose jobs arrive and are cancelled while it is being processed. It keeps a schedule of all
+ * the jobs, the tasks that have started before the current time are frozen (the prefix of the sequence of each machine)
+ * and only the rest of the tasks, the open horizon, are rescheduled:
+ * - an arrival appends the tasks of the new job to the sequences of their machines, and a cancellation removes the tasks
+ *   of the job that have not started, so the schedule is always complete and feasible without any search;
+ * - Reoptimize solves the problem of the open horizon, starting from the current schedule, within a budget.
+ * 
+ * The problem of the open horizon only has the tasks that have not started, with the times relative to the current time.
+ * A job cannot start before its last started task ends nor before the machine of its first open task is free, which is
+ * modelled by a first task in a machine of its own. The machines that are busy only delay the first open task of each job
+ * (they are a relaxation for the others), but the start times of the schedule are always computed with all the constraints,
+ * and a reoptimized schedule only replaces the current one if it is not worse.
+ * 
+ * @tparam Solution type of the solutions of the open horizon, which decides the objective to be minimized.
+ */
+template <typename Solution> class JSPRollingHorizon
+{
+  public:
+    using ProblemType = typename Solution::ProblemType; // type of the problems of the open horizon
+    using TimeType = typename ProblemType::TimeType; // type of the time unit
+    using DateType = typename ProblemType::DateType; // type of the date unit
+    using InstantType = typename TimeComponents<TimeType>::Type; // type of the instants of the events
+
+  private:
+    using Components = TimeComponents<TimeType>;
+    using Operation = std::pair<unsigned int, std::size_t>; // job and position in the job of a task
+
+    // job of the stream
+    struct StreamJob
+    {
+        std::vector<std::pair<unsigned int, TimeType>> tasks; // machine and duration of each task, in order
+        std::vector<TimeType> starts; // start of each task in the schedule
+        DateType due_date; // due date of the job
+        double weight; // weight of the job
+        std::size_t started; // number of tasks that have started
+        bool cancelled; // true if the job has been cancelled after some of its tasks started
+    };
+
+    // machine of the stream
+    struct StreamMachine
+    {
+        std::vector<Operation> sequence; // tasks in the order they are processed
+        std::size_t frozen; // number of tasks that have started
+    };
+
+    std::map<unsigned int, StreamJob> jobs; // jobs that are being or have been processed
+    std::map<unsigned int, StreamMachine> machines; // machines that have been used by the jobs
+    InstantType now; // time of the last event
+
+    /**
+     * @brief Returns a time whose components are all equal to an instant.
+     * 
+     */
+    static TimeType At(InstantType instant)
+    {
+        std::array<InstantType, Components::size> components;
+        components.fill(instant);
+        return Components::Make(components);
+    }
+
+    /**
+     * @brief Returns the time that remains from the current time to the given time, zero if it has passed.
+     * 
+     */
+    TimeType Since(const TimeType& time) const
+    {
+        std::array<InstantType, Components::size> components;
+        for (std::size_t component = 0; component < Components::size; component++) {
+            components[component] = std::max(InstantType{}, Components::Get(time, component) - now);
+        }
+        return Components::Make(components);
+    }
+
+    /**
+     * @brief Returns the end of a task in the schedule.
+     * 
+     */
+    TimeType End(const Operation& operation) const
+    {
+        const StreamJob& job = jobs.at(operation.first);
+        return job.starts[operation.second] + job.tasks[operation.second].second;
+    }
+
+    /**
+     * @brief Computes the start times of the open tasks: each task starts as soon as the current time, the previous task of
+     * its job and the previous task of its machine allow.
+     * 
+     */
+    void UpdateStarts()
+    {
+        std::unordered_map<unsigned int, std::size_t> next_task; // next task of each job without start
+        for (const auto& [jobID, job]: jobs) {
+            next_task[jobID] = job.started;
+        }
+        std::map<unsigned int, std::size_t> next_position; // next task of each machine without start
+        std::size_t pending = 0;
+        for (const auto& [machineID, machine]: machines) {
+            next_position[machineID] = machine.frozen;
+            pending += machine.sequence.size() - machine.frozen;
+        }
+        bool progress = true;
+        while (pending > 0 && progress) {
+            progress = false;
+            for (auto& [machineID, machine]: machines) {
+                std::size_t& k = next_position[machineID];
+                while (k < machine.sequence.size() && machine.sequence[k].second == next_task[machine.sequence[k].first]) {
+                    const auto [jobID, position] = machine.sequence[k];
+                    TimeType start = At(now);
+                    if (position > 0) {
+                        start = std::max(start, End({jobID, position - 1}));
+                    }
+                    if (k > 0) {
+                        start = std::max(start, End(machine.sequence[k - 1]));
+                    }
+                    jobs.at(jobID).starts[position] = start;
+                    next_task[jobID]++;
+                    k++;
+                    pending--;
+                    progress = true;
+                }
+            }
+        }
+        if (pending > 0) {
+            throw std::logic_error("the sequences of the machines form a cycle");
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs a new JSPRollingHorizon, with no jobs.
+     * 
+     * @param now time of the first event.
+     */
+    explicit JSPRollingHorizon(InstantType now = InstantType{}) : now{now} {}
+
+    /**
+     * @brief Advances the current time. The tasks that start before it in the schedule have started, so they are frozen.
+     * 
+     * @param time new current time.
+     */
+    void Advance(InstantType time)
+    {
+        if (time < now) {
+            throw std::invalid_argument("the events are not in chronological order");
+        }
+        now = time;
+        for (auto& [machineID, machine]: machines) {
+            while (machine.frozen < machine.sequence.size()) {
+                const auto [jobID, position] = machine.sequence[machine.frozen];
+                StreamJob& job = jobs.at(jobID);
+                if (!(job.starts[position] < At(now))) {
+                    break;
+                }
+                machine.frozen++;
+                job.started = std::max(job.started, position + 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Adds a job that arrives at the given time. Its tasks are appended to the sequences of their machines.
+     * 
+     * @param time time of the arrival.
+     * @param jobID identifier of the job.
+     * @param tasks machine and duration of each task of the job, in the order they have to be processed.
+     * @param due_date due date of the job.
+     * @param weight weight (importance) of the job.
+     */
+    void AddJob(InstantType time,
+                unsigned int jobID,
+                const std::vector<std::pair<unsigned int, TimeType>>& tasks,
+                DateType due_date = DateType(),
+                double weight = 1)
+    {
+        if (jobs.count(jobID) != 0) {
+            throw std::invalid_argument("the job is already registered");
+        }
+        if (tasks.empty()) {
+            throw std::invalid_argument("the job has no tasks");
+        }
+        std::unordered_set<unsigned int> visited;
+        for (const auto& task: tasks) {
+            if (!visited.insert(task.first).second) {
+                throw std::invalid_argument("the job visits a machine more than once");
+            }
+        }
+        Advance(time);
+        jobs.emplace(jobID, StreamJob{tasks, std::vector<TimeType>(tasks.size()), due_date, weight, 0, false});
+        for (std::size_t position = 0; position < tasks.size(); position++) {
+            machines[tasks[position].first].sequence.emplace_back(jobID, position);
+        }
+        UpdateStarts();
+    }
+
+    /**
+     * @brief Cancels a job at the given time. Its tasks that have not started are removed, those that have started are kept
+     * in the schedule but do not count for the total weighted tardiness.
+     * 
+     * @param time time of the cancellation.
+     * @param jobID identifier of the job.
+     */
+    void CancelJob(InstantType time, unsigned int jobID)
+    {
+        auto found = jobs.find(jobID);
+        if (found == jobs.end() || found->second.cancelled) {
+            throw std::invalid_argument("the job is not registered");
+        }
+        Advance(time);
+        for (auto& [machineID, machine]: machines) {
+            machine.sequence.erase(std::remove_if(machine.sequence.begin() + machine.frozen,
+                                                  machine.sequence.end(),
+                                                  [jobID](const Operation& operation) { return operation.first == jobID; }),
+                                   machine.sequence.end());
+        }
+        StreamJob& job = found->second;
+        if (job.started == 0) {
+            jobs.erase(found);
+        } else {
+            job.tasks.resize(job.started);
+            job.starts.resize(job.started);
+            job.cancelled = true;
+        }
+        UpdateStarts();
+    }
+
+    /**
+     * @brief Reschedules the open horizon with a solver, starting from the current schedule, and keeps the new schedule if it
+     * is not worse than the current one.
+     * 
+     * @tparam RNG type of the random number generator.
+     * @param solver solver to be used.
+     * @param budget budget that limits the resources that the solver can consume.
+     * @param rng random number generator to be used.
+     * @return the objective value of the schedule.
+     */
+    template <typename RNG> double Reoptimize(JSPSolverType solver, SearchBudget& budget, RNG& rng)
+    {
+        // problem of the open horizon, each of its tasks is a task of the stream or the release of a job
+        ProblemType problem;
+        std::unordered_map<unsigned int, Operation> operations; // task of the stream of each task of the problem
+        std::vector<unsigned int> released_jobs; // jobs that have a release task, in the order of their machines
+        unsigned int release_machine = machines.empty() ? 1 : machines.rbegin()->first + 1;
+        unsigned int taskID = 1;
+        for (const auto& [jobID, job]: jobs) {
+            if (job.started == job.tasks.size()) {
+                continue;
+            }
+            problem.AddJob(jobID, job.due_date - now, job.weight);
+            const StreamMachine& machine = machines.at(job.tasks[job.started].first);
+            TimeType release = At(now);
+            if (job.started > 0) {
+                release = std::max(release, End({jobID, job.started - 1}));
+            }
+            if (machine.frozen > 0) {
+                release = std::max(release, End(machine.sequence[machine.frozen - 1]));
+            }
+            if (Since(release) != TimeType{}) {
+                problem.AddMachine(release_machine);
+                problem.AddTask(taskID++, jobID, release_machine++, Since(release));
+                released_jobs.push_back(jobID);
+            }
+            for (std::size_t position = job.started; position < job.tasks.size(); position++) {
+                problem.AddMachine(job.tasks[position].first);
+                operations[taskID] = {jobID, position};
+                problem.AddTask(taskID++, jobID, job.tasks[position].first, job.tasks[position].second);
+            }
+        }
+        if (operations.empty()) {
+            return Objective();
+        }
+
+        // the current schedule of the open horizon, as a sequence of the machines of the problem in order of identifier
+        std::vector<std::vector<unsigned int>> sequence;
+        for (const auto& [machineID, machine]: machines) {
+            if (machine.frozen < machine.sequence.size()) {
+                sequence.emplace_back();
+                std::transform(machine.sequence.begin() + machine.frozen,
+                               machine.sequence.end(),
+                               std::back_inserter(sequence.back()),
+                               [](const Operation& operation) { return operation.first; });
+            }
+        }
+        for (unsigned int jobID: released_jobs) {
+            sequence.push_back({jobID});
+        }
+        JSPWarmStartPopulationGenerator generation_op(JSPWarmStart::GetChromosome(sequence, problem));
+        auto solution = JSPSolvers::Solve<Solution>(solver, budget, [](const Solution&) {}, problem, rng, generation_op);
+
+        // the tasks of each machine are in the topological order of the solution in the order of the machine
+        double value = Objective();
+        auto current = machines;
+        std::vector<std::reference_wrapper<const typename ProblemType::TaskType>> tasks;
+        solution.GetTasksTopologicalOrder(std::back_inserter(tasks));
+        for (auto& [machineID, machine]: machines) {
+            machine.sequence.resize(machine.frozen);
+        }
+        for (const auto& task: tasks) {
+            auto operation = operations.find(task.get().GetTaskID());
+            if (operation != operations.end()) {
+                machines.at(task.get().GetMachine().GetMachineID()).sequence.push_back(operation->second);
+            }
+        }
+        UpdateStarts();
+        if (value < Objective()) {
+            machines = std::move(current);
+            UpdateStarts();
+        }
+        return Objective();
+    }
+
+    /**
+     * @brief Returns the objective value of the schedule: the makespan, or the total weighted tardiness of the jobs that have
+     * not been cancelled. Fuzzy times are replaced by their expected values.
+     * 
+     * @return the objective value of the schedule.
+     */
+    double Objective() const
+    {
+        double value = 0;
+        for (const auto& [jobID, job]: jobs) {
+            if (job.tasks.empty()) {
+                continue;
+            }
+            double completion = static_cast<double>(job.starts.back() + job.tasks.back().second);
+            if constexpr (is_specialization<Solution, JSPMakespanMinimizationSolution>::value) {
+                value = std::max(value, completion);
+            } else if (!job.cancelled) {
+                value += job.weight * std::max(0.0, completion - static_cast<double>(job.due_date));
+            }
+        }
+        return value;
+    }
+
+    /**
+     * @brief Returns the current time, the time of the last event.
+     * 
+     * @return the current time.
+     */
+    InstantType GetTime() const
+    {
+        return now;
+    }
+
+    /**
+     * @brief Returns the start of a task in the schedule.
+     * 
+     * @param jobID identifier of the job of the task.
+     * @param position position of the task in the job.
+     * @return the start of the task.
+     */
+    TimeType GetStart(unsigned int jobID, std::size_t position) const
+    {
+        return jobs.at(jobID).starts.at(position);
+    }
+
+    /**
+     * @brief Returns the number of tasks that have started.
+     * 
+     * @return the number of tasks that have started.
+     */
+    std::size_t GetNumberOfFrozenTasks() const
+    {
+        std::size_t frozen = 0;
+        for (const auto& [machineID, machine]: machines) {
+            frozen += machine.frozen;
+        }
+        return frozen;
+    }
+
+    /**
+     * @brief Returns the number of tasks that have not started, the size of the open horizon.
+     * 
+     * @return the number of tasks that have not started.
+     */
+    std::size_t GetNumberOfOpenTasks() const
+    {
+        std::size_t open = 0;
+        for (const auto& [machineID, machine]: machines) {
+            open += machine.sequence.size() - machine.frozen;
+        }
+        return open;
+    }
+
+    /**
+     * @brief Returns the number of machines that have been used by the jobs.
+     * 
+     * @return the number of machines.
+     */
+    std::size_t GetNumberOfMachines() const
+    {
+        return machines.size();
+    }
+
+    /**
+     * @brief Returns the sequence of the schedule like the solutions print it: a line per machine, in increasing order of
+     * identifier, with the identifiers of the jobs in the order they are processed in the machine.
+     * 
+     * @return the sequence of the schedule.
+     */
+    std::string SolutionSequence() const
+    {
+        std::string sequence;
+        for (const auto& [machineID, machine]: machines) {
+            for (const auto& operation: machine.sequence) {
+                sequence += std::to_string(operation.first) + " ";
+            }
+            sequence += "\n";
+        }
+        return sequence;
+    }
+};
+
+#endif /* JSPROLLINGHORIZON_HPP_ */
@@ -12,10 +12,15 @@
 #define JSPSCHEDULEGENERATIONSCHEMES_HPP_
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <random>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include <utils/instrumentation.hpp>
+
 /**
  * @brief Builds a JSP solution according to the specified priorities.
  * 
@@ -86,6 +91,7 @@ class GT
     template <typename InputIt, typename OutputIt, typename Problem>
     static OutputIt EvaluateSolution(InputIt first, InputIt last, OutputIt dest, const Problem& problem)
     {
+        JSP_SCOPED_TIMER(Probe::EvaluateSolution);
         using TaskType = typename Problem::TaskType;
         using MachineType = typename Problem::MachineType;
         using TimeType = typename Problem::TimeType;
@@ -115,13 +121,14 @@ class GT
 
             auto candidate_task_ect = std::max(est[candidate_task], machine_times[candidate_task.GetMachine()]) + candidate_task.GetDuration();
             // select all tasks in the same machine that may start before the selected task is completed
+            // (the selected task is always in the set, even if its duration is zero)
             std::vector<std::reference_wrapper<const TaskType>> conflict_set;
             std::copy_if(available_tasks.begin(),
                          available_tasks.end(),
                          std::back_inserter(conflict_set),
                          [&est, &machine_times, &candidate_task, &candidate_task_ect](const TaskType& t) {
-                             return t.GetMachine() == candidate_task.GetMachine() &&
-                                    std::max(est[t], machine_times[t.GetMachine()]) < candidate_task_ect;
+                             return t == candidate_task || (t.GetMachine() == candidate_task.GetMachine() &&
+                                                            std::max(est[t], machine_times[t.GetMachine()]) < candidate_task_ect);
                          });
 
             // select the task with the highest priority
@@ -146,4 +153,54 @@ class GT
     }
 };
 
+/**
+ * @brief Semi-active scheduler for JSP. The tasks are scheduled in the order of their priorities, each one as soon as its job
+ * predecessor and the previous task of its machine are completed, so the machines process the tasks in the order of the
+ * priorities. The priorities must follow the order of the tasks in their jobs, as the ones of the permutations with repetition.
+ * 
+ */
+class SemiActive
+{
+  public:
+    /**
+     * @brief Inserts in a container the earliest starting times of the tasks according to
+     * the specified priorities.
+     *      
+     * @tparam InputIt type of the iterator to be used to read the priorities.
+     * @tparam OutputIt type of the iterator to be used to insert the earliest starting times of the tasks.
+     * @tparam Problem type of the problem to be considered.
+     * @param first iterator pointing to the first element in the encoded solution.
+     * @param last iterator pointing to the element past the last element in the encoded solution.
+     * @param dest iterator to be used to insert the earliest starting times of the tasks.
+     * @param problem problem to be considered.
+     * @return the earliest starting times of the tasks.
+     */
+    template <typename InputIt, typename OutputIt, typename Problem>
+    static OutputIt EvaluateSolution(InputIt first, InputIt last, OutputIt dest, const Problem&)
+    {
+        JSP_SCOPED_TIMER(Probe::EvaluateSolution);
+        using TaskType = typename Problem::TaskType;
+        using MachineType = typename Problem::MachineType;
+        using TimeType = typename Problem::TimeType;
+
+        std::vector<std::pair<std::reference_wrapper<const TaskType>, std::size_t>> tasks(first, last); // tasks with their priorities
+        std::sort(tasks.begin(), tasks.end(), [](const auto& t1, const auto& t2) { return t1.second < t2.second; });
+        std::unordered_map<unsigned int, TimeType> job_times; // completion time of the last scheduled task of the jobs
+        std::unordered_map<std::reference_wrapper<const MachineType>, TimeType, std::hash<MachineType>, std::equal_to<MachineType>>
+            machine_times; // earliest starting time of a new task in the machines
+
+        for (const auto& pair: tasks) {
+            const TaskType& current_task = pair.first;
+            auto& job_time = job_times[current_task.GetJob().GetJobID()];
+            auto& machine_time = machine_times[current_task.GetMachine()];
+            auto current_task_est = std::max(job_time, machine_time);
+            job_time = current_task_est + current_task.GetDuration();
+            machine_time = job_time;
+            // store the result
+            *dest++ = std::make_pair(std::cref(current_task), current_task_est);
+        }
+        return dest;
+    }
+};
+
 #endif /* JSPSCHEDULEGENERATIONSCHEMES_HPP_ */
\ No newline at end of file
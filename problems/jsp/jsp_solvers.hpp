@@ -0,0 +1,729 @@
+/**
+ * @file jsp_solvers.hpp
+ * @author Pablo
+ * @brief Configured solvers for JSP.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef JSPSOLVERS_HPP_
+#define JSPSOLVERS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <metaheuristics/evolutionary_algorithm/crossover_operators.hpp>
+#include <metaheuristics/evolutionary_algorithm/evolutionary_algorithm.hpp>
+#include <metaheuristics/evolutionary_algorithm/local_search_policies.hpp>
+#include <metaheuristics/evolutionary_algorithm/memetic_algorithm.hpp>
+#include <metaheuristics/evolutionary_algorithm/mutation_operators.hpp>
+#include <metaheuristics/evolutionary_algorithm/replacement_operators.hpp>
+#include <metaheuristics/evolutionary_algorithm/selection_operators.hpp>
+#include <metaheuristics/tabu_search/tabu_search_variable_length.hpp>
+#include <metaheuristics/utils/checkpoint.hpp>
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp_branch_and_bound.hpp>
+#include <problems/jsp/jsp_generation_operators.hpp>
+#include <problems/jsp/jsp_genetic_encoders.hpp>
+#include <problems/jsp/jsp_lower_bounds.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_neighborhoods.hpp>
+#include <problems/jsp/jsp_path_relinking.hpp>
+#include <utils/template_utils.hpp>
+
+/**
+ * @brief Metaheuristics that can be used to solve a JSP.
+ * 
+ */
+enum class JSPSolverType
+{
+    Memetic, // memetic algorithm (evolutionary algorithm with tabu search)
+    MemeticPathRelinking, // memetic algorithm with path relinking as crossover
+    SteadyStateMemetic, // steady-state memetic algorithm
+    AdaptiveMemetic, // memetic algorithm with adaptive local search
+    Evolutionary, // evolutionary algorithm
+    TabuSearch, // tabu search from a random solution
+    Exact, // branch and bound from the solution of a tabu search
+    Automatic // exact for small instances, memetic algorithm for the rest
+};
+
+/**
+ * @brief Returns the solver with the given name ("memetic", "memetic-pr", "memetic-ss", "memetic-adaptive", "ea", "tabu", "exact"
+ * or "auto").
+ * 
+ * @param name name of the solver.
+ * @return the solver with the given name.
+ */
+inline JSPSolverType ParseJSPSolverType(const std::string& name)
+{
+    if (name == "memetic") {
+        return JSPSolverType::Memetic;
+    } else if (name == "memetic-pr") {
+        return JSPSolverType::MemeticPathRelinking;
+    } else if (name == "memetic-ss") {
+        return JSPSolverType::SteadyStateMemetic;
+    } else if (name == "memetic-adaptive") {
+        return JSPSolverType::AdaptiveMemetic;
+    } else if (name == "ea") {
+        return JSPSolverType::Evolutionary;
+    } else if (name == "tabu") {
+        return JSPSolverType::TabuSearch;
+    } else if (name == "exact") {
+        return JSPSolverType::Exact;
+    } else if (name == "auto") {
+        return JSPSolverType::Automatic;
+    }
+    throw std::invalid_argument("unknown solver " + name);
+}
+
+/**
+ * @brief Provides static functions to run the metaheuristics with the configuration used for the JSP experiments.
+ * 
+ */
+class JSPSolvers
+{
+  public:
+    static constexpr std::size_t exact_tasks = 100; // largest number of tasks of the problems solved exactly by the automatic solver
+    static constexpr std::chrono::milliseconds exact_time_limit{2000}; // maximum time of the exact solver in the automatic solver
+
+  private:
+    template <typename RealNumber>
+    static bool AlmostEqual(RealNumber a, RealNumber b, RealNumber tolerance = std::numeric_limits<RealNumber>::epsilon())
+    {
+        RealNumber d = std::fabs(a - b);
+        if (d <= tolerance) {
+            return true;
+        }
+        if (d < std::fmax(std::fabs(a), std::fabs(b)) * tolerance) {
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Wraps an improvement callback so the search is finished as soon as its best solution reaches the lower bound
+     * of the objective, as it is optimal.
+     * 
+     */
+    template <typename Solution, typename ImprovementCallback, typename Problem>
+    static auto StopAtLowerBound(SearchBudget& budget, const ImprovementCallback& improvement_callback, const Problem& problem)
+    {
+        return [&budget, &improvement_callback, lower_bound = LowerBound<Solution>(problem)](const Solution& solution) {
+            improvement_callback(solution);
+            double value = ObjectiveValue(solution);
+            if (value <= lower_bound || AlmostEqual(value, lower_bound, 1e-9)) {
+                budget.Finish();
+            }
+        };
+    }
+
+    /**
+     * @brief Runs the memetic algorithm with the configuration used for the JSP experiments and the given encoder, crossover
+     * operator and local search policy, generational or steady-state.
+     * 
+     */
+    template <bool SteadyState,
+              typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename EncoderDecoder,
+              typename GenerationOp,
+              typename CrossoverOp,
+              typename LocalSearchPolicy,
+              typename Checkpointer>
+    static Solution ConfiguredMemetic(EvolutionaryLogger<Solution>& evolutionary_logger,
+                                      LocalLogger<Solution>& local_logger,
+                                      SearchBudget& budget,
+                                      const ImprovementCallback& improvement_callback,
+                                      const Problem& problem,
+                                      RNG& rng,
+                                      const EncoderDecoder& encoder_decoder,
+                                      const GenerationOp& generation_op,
+                                      const CrossoverOp& crossover_op,
+                                      const LocalSearchPolicy& local_search_policy,
+                                      Checkpointer& checkpointer)
+    {
+        const auto find_solution = [](auto&&... parameters) {
+            if constexpr (SteadyState) {
+                return MemeticAlgorithm::FindSolutionSteadyState(parameters...);
+            } else {
+                return MemeticAlgorithm::FindSolution(parameters...);
+            }
+        };
+        return find_solution(
+            evolutionary_logger,
+            local_logger,
+            budget,
+            StopAtLowerBound<Solution>(budget, improvement_callback, problem),
+            checkpointer,
+            problem,
+            encoder_decoder,
+            generation_op,
+            problem.GetNumberOfJobs() * problem.GetNumberOfMachines(),
+            PairSelection{},
+            crossover_op,
+            1,
+            Swap{},
+            0.1,
+            Tournament{},
+            false,
+            [&problem](auto, auto no_improving_generations, auto average_quality, auto best_solution_quality) {
+                return no_improving_generations > problem.GetNumberOfJobs() || AlmostEqual(best_solution_quality, average_quality);
+            },
+            rng,
+            TabuSearchVariableLength{},
+            local_search_policy,
+            problem.GetNumberOfJobs() + problem.GetNumberOfMachines(),
+            2 * (problem.GetNumberOfJobs() + problem.GetNumberOfMachines()),
+            [&problem](auto, auto no_improving_iterations) {
+                return no_improving_iterations > 2 * problem.GetNumberOfJobs() + problem.GetNumberOfMachines();
+            },
+            CET<Problem>());
+    }
+
+  public:
+    /**
+     * @brief Returns the value of the objective of a solution, the expected value for fuzzy objectives.
+     * 
+     * @tparam Solution type of the solution.
+     * @param solution solution to be evaluated.
+     * @return the value of the objective.
+     */
+    template <typename Solution> static double ObjectiveValue(const Solution& solution)
+    {
+        if constexpr (is_specialization<Solution, JSPMakespanMinimizationSolution>::value) {
+            return static_cast<double>(solution.GetMakespan());
+        } else {
+            return static_cast<double>(solution.GetTotalWeightedTardiness());
+        }
+    }
+
+    /**
+     * @brief Returns the lower bound of the objective of the solutions of a problem (see JSPLowerBounds), the expected value
+     * for fuzzy objectives.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam Problem type of the problem.
+     * @param problem problem whose objective is bounded.
+     * @return the lower bound of the objective.
+     */
+    template <typename Solution, typename Problem> static double LowerBound(const Problem& problem)
+    {
+        return static_cast<double>(JSPLowerBounds::Objective<Solution>(problem));
+    }
+
+    /**
+     * @brief Returns the optimality gap of an objective value, its relative distance to the lower bound. A gap of zero proves
+     * that the value is optimal.
+     * 
+     * @param value objective value of a solution.
+     * @param lower_bound lower bound of the objective.
+     * @return the gap, between zero and one.
+     */
+    static double Gap(double value, double lower_bound)
+    {
+        return value > 0 ? std::max(0.0, value - lower_bound) / value : 0.0;
+    }
+
+    /**
+     * @brief Solves a JSP with a memetic algorithm.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam EvolutionaryLogger type of the evolutionary logger.
+     * @tparam LocalLogger type of the local logger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial population.
+     * @tparam Checkpointer type of the checkpointer.
+     * @param evolutionary_logger logger where a trace of the evolutionary part of the execution will be stored.
+     * @param local_logger logger where a trace of the local parts of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial population, random by default.
+     * @param checkpointer checkpointer where the state of the search is saved and from which it is resumed, none by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator,
+              typename Checkpointer = IgnoreCheckpoints>
+    static Solution Memetic(EvolutionaryLogger<Solution>& evolutionary_logger,
+                            LocalLogger<Solution>& local_logger,
+                            SearchBudget& budget,
+                            const ImprovementCallback& improvement_callback,
+                            const Problem& problem,
+                            RNG& rng,
+                            const GenerationOp& generation_op = GenerationOp{},
+                            Checkpointer&& checkpointer = Checkpointer{})
+    {
+        return ConfiguredMemetic<false>(evolutionary_logger,
+                                        local_logger,
+                                        budget,
+                                        improvement_callback,
+                                        problem,
+                                        rng,
+                                        PermutationWithRepetition<GT>{},
+                                        generation_op,
+                                        GOX{},
+                                        1.0,
+                                        checkpointer);
+    }
+
+    /**
+     * @brief Solves a JSP with a memetic algorithm whose crossover is the path relinking between the schedules of the parents.
+     * The chromosomes are decoded with semi-active schedules, so the offsprings reach the local search with the machine orders
+     * found in the paths.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam EvolutionaryLogger type of the evolutionary logger.
+     * @tparam LocalLogger type of the local logger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial population.
+     * @tparam Checkpointer type of the checkpointer.
+     * @param evolutionary_logger logger where a trace of the evolutionary part of the execution will be stored.
+     * @param local_logger logger where a trace of the local parts of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume, the intermediate solutions of the paths are
+     * counted as evaluations.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial population, random by default.
+     * @param checkpointer checkpointer where the state of the search is saved and from which it is resumed, none by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator,
+              typename Checkpointer = IgnoreCheckpoints>
+    static Solution MemeticPathRelinking(EvolutionaryLogger<Solution>& evolutionary_logger,
+                                         LocalLogger<Solution>& local_logger,
+                                         SearchBudget& budget,
+                                         const ImprovementCallback& improvement_callback,
+                                         const Problem& problem,
+                                         RNG& rng,
+                                         const GenerationOp& generation_op = GenerationOp{},
+                                         Checkpointer&& checkpointer = Checkpointer{})
+    {
+        return ConfiguredMemetic<false>(evolutionary_logger,
+                                        local_logger,
+                                        budget,
+                                        improvement_callback,
+                                        problem,
+                                        rng,
+                                        PermutationWithRepetition<SemiActive>{},
+                                        generation_op,
+                                        JSPPathRelinking<Solution>(problem, budget),
+                                        1.0,
+                                        checkpointer);
+    }
+
+    /**
+     * @brief Solves a JSP with a steady-state memetic algorithm, where the descendants of each couple replace their parents
+     * in the population as soon as they are improved.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam EvolutionaryLogger type of the evolutionary logger.
+     * @tparam LocalLogger type of the local logger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial population.
+     * @tparam Checkpointer type of the checkpointer.
+     * @param evolutionary_logger logger where a trace of the evolutionary part of the execution will be stored.
+     * @param local_logger logger where a trace of the local parts of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial population, random by default.
+     * @param checkpointer checkpointer where the state of the search is saved and from which it is resumed, none by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator,
+              typename Checkpointer = IgnoreCheckpoints>
+    static Solution SteadyStateMemetic(EvolutionaryLogger<Solution>& evolutionary_logger,
+                                       LocalLogger<Solution>& local_logger,
+                                       SearchBudget& budget,
+                                       const ImprovementCallback& improvement_callback,
+                                       const Problem& problem,
+                                       RNG& rng,
+                                       const GenerationOp& generation_op = GenerationOp{},
+                                       Checkpointer&& checkpointer = Checkpointer{})
+    {
+        return ConfiguredMemetic<true>(evolutionary_logger,
+                                       local_logger,
+                                       budget,
+                                       improvement_callback,
+                                       problem,
+                                       rng,
+                                       PermutationWithRepetition<GT>{},
+                                       generation_op,
+                                       GOX{},
+                                       1.0,
+                                       checkpointer);
+    }
+
+    /**
+     * @brief Solves a JSP with a memetic algorithm that only improves the offsprings that are promising or whose local searches
+     * tend to succeed, skipping the near-duplicates of their parents (see AdaptiveLocalSearch).
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam EvolutionaryLogger type of the evolutionary logger.
+     * @tparam LocalLogger type of the local logger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial population.
+     * @tparam Checkpointer type of the checkpointer.
+     * @param evolutionary_logger logger where a trace of the evolutionary part of the execution will be stored.
+     * @param local_logger logger where a trace of the local parts of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial population, random by default.
+     * @param checkpointer checkpointer where the state of the search is saved and from which it is resumed, none by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator,
+              typename Checkpointer = IgnoreCheckpoints>
+    static Solution AdaptiveMemetic(EvolutionaryLogger<Solution>& evolutionary_logger,
+                                    LocalLogger<Solution>& local_logger,
+                                    SearchBudget& budget,
+                                    const ImprovementCallback& improvement_callback,
+                                    const Problem& problem,
+                                    RNG& rng,
+                                    const GenerationOp& generation_op = GenerationOp{},
+                                    Checkpointer&& checkpointer = Checkpointer{})
+    {
+        return ConfiguredMemetic<false>(evolutionary_logger,
+                                        local_logger,
+                                        budget,
+                                        improvement_callback,
+                                        problem,
+                                        rng,
+                                        PermutationWithRepetition<GT>{},
+                                        generation_op,
+                                        GOX{},
+                                        AdaptiveLocalSearch{},
+                                        checkpointer);
+    }
+
+    /**
+     * @brief Solves a JSP with an evolutionary algorithm.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam Logger type of the logger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial population.
+     * @param logger logger where a trace of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial population, random by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class Logger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator>
+    static Solution Evolutionary(Logger<Solution>& logger,
+                                 SearchBudget& budget,
+                                 const ImprovementCallback& improvement_callback,
+                                 const Problem& problem,
+                                 RNG& rng,
+                                 const GenerationOp& generation_op = GenerationOp{})
+    {
+        return EvolutionaryAlgorithm::FindSolution(
+            logger,
+            budget,
+            StopAtLowerBound<Solution>(budget, improvement_callback, problem),
+            problem,
+            PermutationWithRepetition<GT>{},
+            generation_op,
+            problem.GetNumberOfJobs() * problem.GetNumberOfMachines(),
+            PairSelection{},
+            GOX{},
+            1,
+            Swap{},
+            0.1,
+            Tournament{},
+            false,
+            [&problem](auto, auto no_improving_generations, auto average_quality, auto best_solution_quality) {
+                return no_improving_generations > problem.GetNumberOfJobs() || AlmostEqual(best_solution_quality, average_quality);
+            },
+            rng);
+    }
+
+    /**
+     * @brief Solves a JSP with a tabu search that starts from a random solution or from the first individual of a generator.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam Logger type of the logger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial solution.
+     * @param logger logger where a trace of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial solution, random by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class Logger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator>
+    static Solution TabuSearch(Logger<Solution>& logger,
+                               SearchBudget& budget,
+                               const ImprovementCallback& improvement_callback,
+                               const Problem& problem,
+                               RNG& rng,
+                               const GenerationOp& generation_op = GenerationOp{})
+    {
+        std::vector<Solution> initial_solution;
+        generation_op.template GetIndividuals<Solution>(std::back_inserter(initial_solution), problem, 1, rng);
+        budget.AddEvaluations(1);
+        return TabuSearchVariableLength::FindSolution(
+            logger,
+            budget,
+            StopAtLowerBound<Solution>(budget, improvement_callback, problem),
+            initial_solution.front(),
+            1,
+            problem.GetNumberOfJobs() + problem.GetNumberOfMachines(),
+            [&problem](auto, auto no_improving_iterations) {
+                return no_improving_iterations > 10 * problem.GetNumberOfJobs() * problem.GetNumberOfMachines();
+            },
+            CET<Problem>());
+    }
+
+    /**
+     * @brief Solves a JSP exactly with a branch and bound (see JSPBranchAndBound) whose first upper bound is the makespan of
+     * a tabu search. Only the makespan of the problems with crisp durations can be minimized.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam Logger type of the logger of the tabu search.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial solution of the tabu search.
+     * @param logger logger where a trace of the tabu search will be stored.
+     * @param budget budget that limits the resources that the search can consume, it is finished if the solution is proven to be optimal.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial solution of the tabu search, random by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class Logger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator>
+    static Solution Exact(Logger<Solution>& logger,
+                          SearchBudget& budget,
+                          const ImprovementCallback& improvement_callback,
+                          const Problem& problem,
+                          RNG& rng,
+                          const GenerationOp& generation_op = GenerationOp{})
+    {
+        if constexpr (!is_specialization<Solution, JSPMakespanMinimizationSolution>::value) {
+            throw std::invalid_argument("the exact solver only minimizes the makespan");
+        } else {
+            if (!JSPBranchAndBound::IsApplicable(problem)) {
+                throw std::invalid_argument("the exact solver needs crisp durations");
+            }
+            auto initial_solution = TabuSearch(logger, budget, improvement_callback, problem, rng, generation_op);
+            return JSPBranchAndBound::FindSolution(budget, StopAtLowerBound<Solution>(budget, improvement_callback, problem), initial_solution);
+        }
+    }
+
+    /**
+     * @brief Solves a JSP with the exact solver if it is small (at most exact_tasks tasks) and its makespan with crisp durations
+     * is minimized, and with the memetic algorithm in other case. The exact solver can spend at most exact_time_limit, if it
+     * does not prove that its solution is optimal in that time the memetic algorithm tries to improve it with the rest of the budget.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam EvolutionaryLogger type of the evolutionary logger.
+     * @tparam LocalLogger type of the local logger.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial solutions.
+     * @param evolutionary_logger logger where a trace of the evolutionary part of the execution will be stored.
+     * @param local_logger logger where a trace of the local parts of the execution will be stored.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial solutions, random by default.
+     * @return the best solution found.
+     */
+    template <typename Solution,
+              template <typename>
+              class EvolutionaryLogger,
+              template <typename>
+              class LocalLogger,
+              typename ImprovementCallback,
+              typename Problem,
+              typename RNG,
+              typename GenerationOp = JSPRandomPopulationGenerator>
+    static Solution Automatic(EvolutionaryLogger<Solution>& evolutionary_logger,
+                              LocalLogger<Solution>& local_logger,
+                              SearchBudget& budget,
+                              const ImprovementCallback& improvement_callback,
+                              const Problem& problem,
+                              RNG& rng,
+                              const GenerationOp& generation_op = GenerationOp{})
+    {
+        if constexpr (is_specialization<Solution, JSPMakespanMinimizationSolution>::value) {
+            if (problem.GetNumberOfTasks() <= exact_tasks && JSPBranchAndBound::IsApplicable(problem)) {
+                SearchBudget slice = budget.Slice(exact_time_limit);
+                auto best = Exact(local_logger, slice, improvement_callback, problem, rng, generation_op);
+                budget.AddEvaluations(slice.GetEvaluations() - budget.GetEvaluations());
+                if (slice.Finished()) {
+                    budget.Finish();
+                }
+                if (budget.Exhausted()) {
+                    return best;
+                }
+                // only the solutions that improve the one of the exact solver are published
+                const auto publish = [&improvement_callback, &best](const Solution& solution) {
+                    if (ObjectiveValue(solution) < ObjectiveValue(best)) {
+                        improvement_callback(solution);
+                    }
+                };
+                auto solution = Memetic(evolutionary_logger, local_logger, budget, publish, problem, rng, generation_op);
+                return ObjectiveValue(solution) < ObjectiveValue(best) ? solution : best;
+            }
+        }
+        return Memetic(evolutionary_logger, local_logger, budget, improvement_callback, problem, rng, generation_op);
+    }
+
+    /**
+     * @brief Solves a JSP with the given metaheuristic. The logs of the local searches inside the memetic algorithm are discarded.
+     * Like every solver of this class, it finishes the search as soon as its best solution reaches the lower bound of the objective.
+     * 
+     * @tparam Solution type of the solution.
+     * @tparam ImprovementCallback type of the function to be called each time a new best solution is found.
+     * @tparam Problem type of the problem.
+     * @tparam RNG type of the random number generator.
+     * @tparam GenerationOp type of the generator of the initial solutions.
+     * @param solver metaheuristic to be used.
+     * @param budget budget that limits the resources that the algorithm can consume.
+     * @param improvement_callback function to be called with each new best solution found.
+     * @param problem problem to be solved.
+     * @param rng random number generator to be used.
+     * @param generation_op generator of the initial solutions, random by default.
+     * @return the best solution found.
+     */
+    template <typename Solution, typename ImprovementCallback, typename Problem, typename RNG, typename GenerationOp = JSPRandomPopulationGenerator>
+    static Solution Solve(JSPSolverType solver,
+                          SearchBudget& budget,
+                          const ImprovementCallback& improvement_callback,
+                          const Problem& problem,
+                          RNG& rng,
+                          const GenerationOp& generation_op = GenerationOp{})
+    {
+        switch (solver) {
+        case JSPSolverType::Memetic: {
+            NullEvolutionaryAlgorithmLogger<Solution> evolutionary_logger;
+            NullLocalSearchLogger<Solution> local_logger;
+            return Memetic(evolutionary_logger, local_logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        case JSPSolverType::MemeticPathRelinking: {
+            NullEvolutionaryAlgorithmLogger<Solution> evolutionary_logger;
+            NullLocalSearchLogger<Solution> local_logger;
+            return MemeticPathRelinking(evolutionary_logger, local_logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        case JSPSolverType::SteadyStateMemetic: {
+            NullEvolutionaryAlgorithmLogger<Solution> evolutionary_logger;
+            NullLocalSearchLogger<Solution> local_logger;
+            return SteadyStateMemetic(evolutionary_logger, local_logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        case JSPSolverType::AdaptiveMemetic: {
+            NullEvolutionaryAlgorithmLogger<Solution> evolutionary_logger;
+            NullLocalSearchLogger<Solution> local_logger;
+            return AdaptiveMemetic(evolutionary_logger, local_logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        case JSPSolverType::Evolutionary: {
+            NullEvolutionaryAlgorithmLogger<Solution> logger;
+            return Evolutionary(logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        case JSPSolverType::TabuSearch: {
+            NullLocalSearchLogger<Solution> logger;
+            return TabuSearch(logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        case JSPSolverType::Exact: {
+            NullLocalSearchLogger<Solution> logger;
+            return Exact(logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        case JSPSolverType::Automatic: {
+            NullEvolutionaryAlgorithmLogger<Solution> evolutionary_logger;
+            NullLocalSearchLogger<Solution> local_logger;
+            return Automatic(evolutionary_logger, local_logger, budget, improvement_callback, problem, rng, generation_op);
+        }
+        }
+        throw std::invalid_argument("unknown solver");
+    }
+};
+
+#endif /* JSPSOLVERS_HPP_ */
@@ -0,0 +1,278 @@
+/**
+ * @file jsp_warm_start.hpp
+ * @author Pablo
+ * @brief Warm start of the JSP metaheuristics from an existing schedule.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef JSPWARMSTART_HPP_
+#define JSPWARMSTART_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp_genetic_encoders.hpp>
+#include <problems/jsp/jsp_schedule_generation_schemes.hpp>
+
+/**
+ * @brief Provides static functions to turn a machine sequence, as printed by SolutionSequence, into a chromosome
+ * (a permutation with repetition) of a possibly different problem.
+ * 
+ */
+class JSPWarmStart
+{
+  public:
+    /**
+     * @brief Reads a machine sequence: a line per machine, in increasing order of identifier, with the identifiers
+     * of the jobs in the order they are processed in the machine. Lines that do not start with a number,
+     * like the first line printed by ToString, are skipped.
+     * 
+     * @param is input stream.
+     * @return the identifiers of the jobs processed in each machine, in order.
+     */
+    static std::vector<std::vector<unsigned int>> ReadSequence(std::istream& is)
+    {
+        std::vector<std::vector<unsigned int>> sequence;
+        std::string line;
+        while (std::getline(is, line)) {
+            std::istringstream fields(line);
+            std::vector<unsigned int> jobs;
+            unsigned int job;
+            while (fields >> job) {
+                jobs.push_back(job);
+            }
+            if (!jobs.empty()) {
+                sequence.push_back(std::move(jobs));
+            }
+        }
+        return sequence;
+    }
+
+    /**
+     * @brief Returns a chromosome whose tasks follow a machine sequence, which can come from a previous version of the problem.
+     * The tasks are listed in an order compatible with the orders of the jobs and of the machines:
+     * - the jobs of the sequence that are not in the problem are ignored;
+     * - the tasks that are not in the sequence (of new jobs, or of jobs that now visit other machines) are spread
+     *   evenly along the chromosome, each task of a job after its previous task;
+     * - if the sequence is infeasible (the orders of the machines and the jobs form a cycle), the blocked task closest
+     *   to the front of its machine is moved to the front, which removes the cycle with the least change.
+     * When the chromosome is decoded the schedule generation scheme makes it active, so idle times left by removed jobs are filled.
+     * 
+     * @tparam Problem type of the problem.
+     * @param sequence identifiers of the jobs processed in each machine (the first line is the machine with the lowest identifier).
+     * @param problem problem to be solved.
+     * @return the chromosome.
+     */
+    template <typename Problem>
+    static std::vector<unsigned int> GetChromosome(const std::vector<std::vector<unsigned int>>& sequence, const Problem& problem)
+    {
+        using JobType = typename Problem::JobType;
+        using MachineType = typename Problem::MachineType;
+        using TaskType = typename Problem::TaskType;
+
+        std::vector<std::reference_wrapper<const JobType>> jobs;
+        problem.GetJobs(std::back_inserter(jobs));
+        std::sort(jobs.begin(), jobs.end(), [](const JobType& j1, const JobType& j2) { return j1.GetJobID() < j2.GetJobID(); });
+        std::vector<std::reference_wrapper<const MachineType>> machines;
+        problem.GetMachines(std::back_inserter(machines));
+        std::sort(
+            machines.begin(), machines.end(), [](const MachineType& m1, const MachineType& m2) { return m1.GetMachineID() < m2.GetMachineID(); });
+
+        // jobs of each machine that are in the problem and visit the machine, in the order of the sequence
+        std::unordered_map<unsigned int, std::vector<unsigned int>> machine_jobs;
+        std::unordered_map<unsigned int, std::unordered_map<unsigned int, std::size_t>> positions; // position of each job in its machine
+        for (std::size_t i = 0; i < machines.size() && i < sequence.size(); i++) {
+            unsigned int machineID = machines[i].get().GetMachineID();
+            std::vector<std::reference_wrapper<const TaskType>> tasks;
+            problem.GetMachineTasks(std::back_inserter(tasks), machineID);
+            std::unordered_map<unsigned int, bool> visits;
+            for (const TaskType& task: tasks) {
+                visits[task.GetJob().GetJobID()] = true;
+            }
+            for (unsigned int job: sequence[i]) {
+                if (visits.count(job) && positions[machineID].count(job) == 0) {
+                    positions[machineID][job] = machine_jobs[machineID].size();
+                    machine_jobs[machineID].push_back(job);
+                }
+            }
+        }
+        std::unordered_map<unsigned int, std::vector<bool>> scheduled; // scheduled jobs of each machine
+        std::unordered_map<unsigned int, std::size_t> front; // first job of each machine not scheduled yet
+        for (const auto& [machineID, list]: machine_jobs) {
+            scheduled[machineID].assign(list.size(), false);
+            front[machineID] = 0;
+        }
+
+        std::size_t total = problem.GetNumberOfTasks();
+        std::size_t unsequenced = 0;
+        std::unordered_map<unsigned int, std::size_t> next; // next task of each job
+        for (const JobType& job: jobs) {
+            next[job.GetJobID()] = 0;
+            for (std::size_t k = 0; k < problem.GetNumberOfTasksInJob(job.GetJobID()); k++) {
+                const TaskType& task = problem.GetTask(job.GetJobID(), k);
+                unsequenced += positions[task.GetMachine().GetMachineID()].count(job.GetJobID()) == 0;
+            }
+        }
+
+        std::vector<unsigned int> chromosome;
+        chromosome.reserve(total);
+        std::size_t placed_unsequenced = 0;
+        const auto schedule = [&](unsigned int jobID, unsigned int machineID, bool sequenced) {
+            chromosome.push_back(jobID);
+            next[jobID]++;
+            if (sequenced) {
+                scheduled[machineID][positions[machineID][jobID]] = true;
+                while (front[machineID] < scheduled[machineID].size() && scheduled[machineID][front[machineID]]) {
+                    front[machineID]++;
+                }
+            } else {
+                placed_unsequenced++;
+            }
+        };
+        while (chromosome.size() < total) {
+            bool progress = false;
+            // the sequenced tasks that are next in their job and in their machine
+            for (const JobType& job: jobs) {
+                unsigned int jobID = job.GetJobID();
+                while (next[jobID] < problem.GetNumberOfTasksInJob(jobID)) {
+                    unsigned int machineID = problem.GetTask(jobID, next[jobID]).GetMachine().GetMachineID();
+                    auto position = positions[machineID].find(jobID);
+                    if (position == positions[machineID].end() || position->second != front[machineID]) {
+                        break;
+                    }
+                    schedule(jobID, machineID, true);
+                    progress = true;
+                }
+            }
+            // the unsequenced tasks, when their turn arrives so they are spread along the chromosome
+            for (const JobType& job: jobs) {
+                unsigned int jobID = job.GetJobID();
+                if (next[jobID] < problem.GetNumberOfTasksInJob(jobID)) {
+                    unsigned int machineID = problem.GetTask(jobID, next[jobID]).GetMachine().GetMachineID();
+                    double turn = static_cast<double>(placed_unsequenced) * total / std::max<std::size_t>(unsequenced, 1);
+                    if (positions[machineID].count(jobID) == 0 && (chromosome.size() >= turn || !progress)) {
+                        schedule(jobID, machineID, false);
+                        progress = true;
+                    }
+                }
+            }
+            if (progress) {
+                continue;
+            }
+            // every job is blocked by the order of a machine: the task closest to the front of its machine is moved to the front
+            unsigned int best_job = 0;
+            unsigned int best_machine = 0;
+            std::size_t best_distance = std::numeric_limits<std::size_t>::max();
+            for (const JobType& job: jobs) {
+                unsigned int jobID = job.GetJobID();
+                if (next[jobID] < problem.GetNumberOfTasksInJob(jobID)) {
+                    unsigned int machineID = problem.GetTask(jobID, next[jobID]).GetMachine().GetMachineID();
+                    std::size_t distance = positions[machineID][jobID] - front[machineID];
+                    if (distance < best_distance) {
+                        best_distance = distance;
+                        best_job = jobID;
+                        best_machine = machineID;
+                    }
+                }
+            }
+            schedule(best_job, best_machine, true);
+        }
+        return chromosome;
+    }
+};
+
+/**
+ * @brief Population generator for JSP that starts from a given chromosome. The first individual is the chromosome itself,
+ * and the others are copies with an increasing number of random exchanges of genes, so the population keeps the structure
+ * of the chromosome but is diverse enough for the evolutionary algorithms.
+ * 
+ */
+class JSPWarmStartPopulationGenerator
+{
+  private:
+    std::vector<unsigned int> chromosome; // chromosome of the initial solution
+    double diversity; // exchanges of the last individual, relative to the length of the chromosome
+
+  public:
+    /**
+     * @brief Constructs a new JSPWarmStartPopulationGenerator.
+     * 
+     * @param chromosome chromosome of the initial solution, for instance from JSPWarmStart::GetChromosome.
+     * @param diversity exchanges of genes of the last individual, relative to the length of the chromosome.
+     */
+    explicit JSPWarmStartPopulationGenerator(std::vector<unsigned int> chromosome, double diversity = 0.5) :
+        chromosome{std::move(chromosome)},
+        diversity{diversity}
+    {}
+
+    /**
+     * @brief Inserts in a container a population of individuals around the chromosome.
+     * 
+     * @tparam Solution type of the solutions.
+     * @tparam Iter type of the iterator to be used to insert the individuals.
+     * @tparam Problem type of the problem.
+     * @tparam RNG random number generator.
+     * @param dest iterator to be used to insert the individuals.
+     * @param problem base problem.
+     * @param population_size size of the population (number of individuals).
+     * @param rng random number generator.
+     * @return an iterator to the individual past the last individual inserted.
+     */
+    template <typename Solution, typename Iter, typename Problem, typename RNG>
+    Iter GetIndividuals(Iter dest, const Problem& problem, unsigned int population_size, RNG& rng) const
+    {
+        SearchBudget budget;
+        return GetIndividuals<Solution>(dest, problem, population_size, rng, budget);
+    }
+
+    /**
+     * @brief Inserts in a container a population of individuals around the chromosome, each of them consumes an evaluation
+     * of the budget. If the budget is exhausted the population is cut short, but it has at least one individual, the
+     * initial solution.
+     * 
+     * @tparam Solution type of the solutions.
+     * @tparam Iter type of the iterator to be used to insert the individuals.
+     * @tparam Problem type of the problem.
+     * @tparam RNG random number generator.
+     * @param dest iterator to be used to insert the individuals.
+     * @param problem base problem.
+     * @param population_size size of the population (maximum number of individuals).
+     * @param rng random number generator.
+     * @param budget budget that limits the resources that the generation can consume.
+     * @return an iterator to the individual past the last individual inserted.
+     */
+    template <typename Solution, typename Iter, typename Problem, typename RNG>
+    Iter GetIndividuals(Iter dest, const Problem& problem, unsigned int population_size, RNG& rng, SearchBudget& budget) const
+    {
+        if (chromosome.empty()) {
+            return dest;
+        }
+        std::uniform_int_distribution<std::size_t> gene(0, chromosome.size() - 1);
+        for (unsigned int i = 0; i < population_size && (i == 0 || !budget.ExhaustedNow()); i++) {
+            std::vector<unsigned int> individual = chromosome;
+            auto exchanges = static_cast<std::size_t>(std::lround(diversity * chromosome.size() * i / population_size));
+            for (std::size_t e = 0; e < exchanges; e++) {
+                std::swap(individual[gene(rng)], individual[gene(rng)]);
+            }
+            ++dest = PermutationWithRepetition<GT>::DecodeSolution<Solution>(individual.begin(), individual.end(), problem);
+            budget.AddEvaluations(1);
+        }
+        return dest;
+    }
+};
+
+#endif /* JSPWARMSTART_HPP_ */
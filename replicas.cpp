@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_job.hpp>
+#include <problems/jsp/jsp_machine.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_solvers.hpp>
+#include <problems/jsp/jsp_task.hpp>
+#include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <utils/philox.hpp>
+#include <utils/thread_pool.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+/**
+ * @brief Result of a replica.
+ * 
+ */
+struct Replica
+{
+    double value; // objective value of the best solution found, the expected value for fuzzy objectives
+    double time; // wall-clock time in seconds
+};
+
+/**
+ * @brief Configuration of the replicas.
+ * 
+ */
+struct Configuration
+{
+    std::string solver_name = "memetic"; // name of the solver
+    std::string objective = "twt"; // objective to be minimized, makespan or twt
+    unsigned int replicas = 30; // number of replicas
+    unsigned int threads = 0; // worker threads, 0 to use one per hardware thread
+    long time_limit = 0; // wall-clock time per replica in milliseconds, 0 for no limit
+    std::uint64_t seed = 0; // seed of the random number generator, each replica uses its own stream
+};
+
+/**
+ * @brief Runs the replicas of an instance concurrently. All the replicas share the problem.
+ * 
+ * @tparam Solution type of the solution.
+ * @tparam Problem type of the problem.
+ * @param configuration configuration of the replicas.
+ * @param problem problem to be solved.
+ * @return the results of the replicas, in replica order.
+ */
+template <typename Solution, typename Problem> static std::vector<Replica> RunReplicas(const Configuration& configuration, const Problem& problem)
+{
+    const auto solver = ParseJSPSolverType(configuration.solver_name);
+    std::vector<std::future<Replica>> futures;
+    {
+        ThreadPool pool(configuration.threads);
+        for (unsigned int replica = 0; replica < configuration.replicas; replica++) {
+            futures.push_back(pool.Submit([&configuration, &problem, solver, replica]() {
+                Philox4x32 rng(configuration.seed, replica);
+                SearchBudget budget =
+                    configuration.time_limit > 0 ? SearchBudget(std::chrono::milliseconds(configuration.time_limit)) : SearchBudget();
+                auto best = JSPSolvers::Solve<Solution>(solver, budget, IgnoreImprovements{}, problem, rng);
+                return Replica{JSPSolvers::ObjectiveValue(best), std::chrono::duration<double>(budget.Elapsed()).count()};
+            }));
+        }
+    }
+    std::vector<Replica> replicas;
+    for (auto& future: futures) {
+        replicas.push_back(future.get());
+    }
+    return replicas;
+}
+
+/**
+ * @brief Writes the summary of the replicas, with the same statistics as the scripts in scripts/stats and the optimality
+ * gap of the best value, followed by the value and time of each replica.
+ * 
+ * @param os stream where the summary will be written.
+ * @param configuration configuration of the replicas.
+ * @param replicas results of the replicas.
+ * @param lower_bound lower bound of the objective of the instance.
+ */
+static void WriteSummary(std::ostream& os, const Configuration& configuration, const std::vector<Replica>& replicas, double lower_bound)
+{
+    double best = replicas.front().value;
+    double sum = 0;
+    double time = 0;
+    for (const auto& replica: replicas) {
+        best = std::min(best, replica.value);
+        sum += replica.value;
+        time += replica.time;
+    }
+    double mean = sum / replicas.size();
+    double squares = 0;
+    for (const auto& replica: replicas) {
+        squares += (replica.value - mean) * (replica.value - mean);
+    }
+    double standard_deviation = replicas.size() > 1 ? std::sqrt(squares / (replicas.size() - 1)) : 0;
+
+    os << "Best = " << best << std::endl;
+    os << "Average = " << mean << std::endl;
+    os << "Standard deviation = " << standard_deviation << std::endl;
+    os << "Average execution time = " << time / replicas.size() << std::endl;
+    os << "Lower bound = " << lower_bound << std::endl;
+    os << "Gap = " << JSPSolvers::Gap(best, lower_bound) << std::endl;
+    os << "Seed = " << configuration.seed << std::endl;
+    os << "REPLICAS" << std::endl;
+    for (std::size_t i = 0; i < replicas.size(); i++) {
+        os << i << ' ' << replicas[i].value << ' ' << replicas[i].time << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-replicas [-s memetic|memetic-pr|memetic-ss|memetic-adaptive|ea|tabu|exact|auto] [-o makespan|twt] [-r replicas]
+    //                         [-j threads] [-t milliseconds] [-seed seed] instance summary
+    Configuration configuration;
+    configuration.seed = static_cast<std::uint64_t>(std::random_device{}()) << 32 | std::random_device{}();
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg.size() > 1 && arg[0] == '-' && i + 1 < argc) {
+            std::string value(argv[++i]);
+            if (arg == "-s") {
+                configuration.solver_name = value;
+            } else if (arg == "-o") {
+                configuration.objective = value;
+            } else if (arg == "-r") {
+                configuration.replicas = std::stoul(value);
+            } else if (arg == "-j") {
+                configuration.threads = std::stoul(value);
+            } else if (arg == "-t") {
+                configuration.time_limit = std::stol(value);
+            } else if (arg == "-seed") {
+                configuration.seed = std::stoull(value);
+            } else {
+                throw std::invalid_argument("unknown option " + arg);
+            }
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.size() != 2) {
+        throw std::invalid_argument("Missing arguments");
+    }
+    if (configuration.replicas == 0) {
+        throw std::invalid_argument("at least one replica is needed");
+    }
+    if (configuration.objective != "makespan" && configuration.objective != "twt") {
+        throw std::invalid_argument("unknown objective " + configuration.objective);
+    }
+
+    // the durations are fuzzy, crisp instances are read as degenerate fuzzy numbers
+    using JobType = JSPJob<double>;
+    using MachineType = JSPMachine;
+    using TaskType = JSPTask<TriangularFuzzyNumber<double>, JobType, MachineType>;
+    using ProblemType = JSP<TaskType, JobType, MachineType>;
+
+    // the instance is read once and shared by all the replicas
+    const auto& path = paths[0];
+    const auto problem = JSPBinaryInstance::IsBinaryInstance(path) ? read_binary<TaskType, JobType, MachineType>(path)
+                         : configuration.objective == "twt"        ? read_standard_due_dates_file<TaskType, JobType, MachineType>(path)
+                                                                   : read_standard_file<TaskType, JobType, MachineType>(path);
+    const auto replicas = configuration.objective == "twt"
+                              ? RunReplicas<JSPTotalWeightedTardinessMinimizationSolution<ProblemType>>(configuration, problem)
+                              : RunReplicas<JSPMakespanMinimizationSolution<ProblemType>>(configuration, problem);
+    const double lower_bound = configuration.objective == "twt"
+                                   ? JSPSolvers::LowerBound<JSPTotalWeightedTardinessMinimizationSolution<ProblemType>>(problem)
+                                   : JSPSolvers::LowerBound<JSPMakespanMinimizationSolution<ProblemType>>(problem);
+
+    std::ofstream summary(paths[1]);
+    WriteSummary(summary, configuration, replicas, lower_bound);
+    return 0;
+}
@@ -0,0 +1,26 @@
+import csv
+import struct
+import sys
+
+SOURCES = ['evolutionary_algorithm', 'local_search']
+MESSAGES = [
+    ['', 'budget_exhausted'],
+    ['', 'all_moves_tabu', 'no_neighbors', 'restart_offspring1', 'restart_offspring2'],
+]
+HEADER = struct.Struct('=8sII')
+RECORD = struct.Struct('=qddIIIIIBBH')
+
+f = open(sys.argv[1], 'rb')
+magic, version, record_size = HEADER.unpack(f.read(HEADER.size))
+if magic != b'JSPTRACE' or version != 1 or record_size != RECORD.size:
+    sys.exit('Not a binary trace')
+out = csv.writer(open(sys.argv[2], 'w', newline='') if len(sys.argv) > 2 else sys.stdout)
+out.writerow(['source', 'msg', 'generation', 'iteration', 'timestamp_ns', 'quality', 'average_quality',
+              'neighbors_generated', 'neighbors_evaluated', 'value'])
+while True:
+    data = f.read(RECORD.size)
+    if len(data) < RECORD.size:
+        break
+    timestamp, quality, average, generation, iteration, generated, evaluated, value, source, msg, _ = RECORD.unpack(data)
+    out.writerow([SOURCES[source], MESSAGES[source][msg], generation, iteration, timestamp, quality, average,
+                  generated, evaluated, value])
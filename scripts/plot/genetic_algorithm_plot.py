@@ -1,11 +1,17 @@
+import csv
 import sys
 import re
 import matplotlib.pyplot as plt
 
 f = open(sys.argv[1], 'r')
-trace = f.read()
-average = list(map(float, re.findall('Average quality = (.*)', trace)))
-maximum = list(map(float, re.findall('Maximum quality = (.*)', trace)))
+if sys.argv[1].endswith('.csv'):
+    rows = [row for row in csv.DictReader(f) if row['source'] == 'evolutionary_algorithm']
+    average = [float(row['average_quality']) for row in rows]
+    maximum = [float(row['quality']) for row in rows]
+else:
+    trace = f.read()
+    average = list(map(float, re.findall('Average quality = (.*)', trace)))
+    maximum = list(map(float, re.findall('Maximum quality = (.*)', trace)))
 plt.plot(average, label='average')
 plt.plot(maximum, label='maximum')
 plt.title('Fitness evolution')
@@ -1,10 +1,14 @@
+import csv
 import sys
 import re
 import matplotlib.pyplot as plt
 
 f = open(sys.argv[1], 'r')
-trace = f.read()
-quality = list(map(float, re.findall('Quality = (.*)', trace)))
+if sys.argv[1].endswith('.csv'):
+    quality = [float(row['quality']) for row in csv.DictReader(f) if row['source'] == 'local_search']
+else:
+    trace = f.read()
+    quality = list(map(float, re.findall('Quality = (.*)', trace)))
 plt.plot(quality, label='quality')
 plt.title('Quality evolution')
 plt.xlabel('Iterations')
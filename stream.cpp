@@ -0,0 +1,189 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <metaheuristics/utils/search_budget.hpp>
+#include <problems/jsp/jsp.hpp>
+#include <problems/jsp/jsp_job.hpp>
+#include <problems/jsp/jsp_machine.hpp>
+#include <problems/jsp/jsp_makespan_minimization_solution.hpp>
+#include <problems/jsp/jsp_rolling_horizon.hpp>
+#include <problems/jsp/jsp_solvers.hpp>
+#include <problems/jsp/jsp_task.hpp>
+#include <problems/jsp/jsp_total_weighted_tardiness_minimization_solution.hpp>
+#include <utils/philox.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+// Protocol: each event is a line of space-separated key=value fields read from the standard input, the first field is the
+// command. The events are in chronological order.
+//
+//   add time=<t> job=<id> tasks=<machine>:<duration>[,<machine>:<duration>...] [due=<date>] [weight=<w>]
+//     a job arrives, its tasks have to be processed in the given order
+//   cancel time=<t> job=<id>
+//     a job is cancelled, its tasks that have not started are removed
+//   advance time=<t>
+//     the time advances without arrivals or cancellations
+//
+// The tasks that start before the time of an event are frozen, and after each event the rest of the tasks (the open horizon)
+// are rescheduled from the current schedule within the budget of an event. Each event is answered with a line:
+//
+//   schedule time=<t> value=<value> frozen=<n> open=<n> time_ms=<ms> evaluations=<n> machines=<m>
+//     followed by <m> lines with the jobs processed in each machine, in order
+//   error message=<message>
+//
+// The value is the makespan or the total weighted tardiness of the whole schedule, including the frozen tasks.
+//
+// The budget of an event is checked between the steps of the solver (decoding an individual, an iteration of a tabu search),
+// so an event can last one step longer than its time limit. An iteration of the tabu search over a large open horizon is the
+// longest of these steps (up to several hundred milliseconds minimizing the total weighted tardiness), so the default
+// solver is auto, whose memetic algorithm starts decoding the individuals of its initial population, which are short steps.
+
+// the durations are fuzzy, crisp durations are degenerate fuzzy numbers
+using JobType = JSPJob<double>;
+using MachineType = JSPMachine;
+using TaskType = JSPTask<TriangularFuzzyNumber<double>, JobType, MachineType>;
+using ProblemType = JSP<TaskType, JobType, MachineType>;
+
+/**
+ * @brief Configuration of the scheduler.
+ * 
+ */
+struct Configuration
+{
+    std::string solver_name = "auto"; // name of the solver
+    std::string objective = "twt"; // objective to be minimized, makespan or twt
+    long time_limit = 100; // wall-clock time per event in milliseconds, 0 for no limit
+    unsigned long long evaluation_limit = std::numeric_limits<unsigned long long>::max(); // maximum number of evaluations per event
+    std::uint64_t seed = 0; // seed of the random number generator
+};
+
+/**
+ * @brief Parses the tasks of a job, a comma-separated list of machine:duration pairs.
+ * 
+ * @param value list of tasks.
+ * @return the machine and the duration of each task.
+ */
+static std::vector<std::pair<unsigned int, TaskType::TimeType>> ParseTasks(const std::string& value)
+{
+    std::vector<std::pair<unsigned int, TaskType::TimeType>> tasks;
+    std::istringstream list(value);
+    std::string task;
+    while (std::getline(list, task, ',')) {
+        auto separator = task.find(':');
+        if (separator == std::string::npos) {
+            throw std::invalid_argument("malformed task " + task);
+        }
+        double duration = std::stod(task.substr(separator + 1));
+        tasks.emplace_back(std::stoul(task.substr(0, separator)), TaskType::TimeType(duration, duration, duration));
+    }
+    return tasks;
+}
+
+/**
+ * @brief Schedules the events of the standard input and answers each one with the new schedule.
+ * 
+ * @tparam Solution type of the solutions of the open horizon.
+ * @param configuration configuration of the scheduler.
+ */
+template <typename Solution> static void Run(const Configuration& configuration)
+{
+    JSPRollingHorizon<Solution> scheduler;
+    JSPSolverType solver = ParseJSPSolverType(configuration.solver_name);
+    Philox4x32 rng(configuration.seed);
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream fields(line);
+        std::string command;
+        if (!(fields >> command)) {
+            continue;
+        }
+        try {
+            std::map<std::string, std::string> values;
+            std::string field;
+            while (fields >> field) {
+                auto separator = field.find('=');
+                if (separator == std::string::npos) {
+                    throw std::invalid_argument("malformed field " + field);
+                }
+                values[field.substr(0, separator)] = field.substr(separator + 1);
+            }
+            if (values.count("time") == 0) {
+                throw std::invalid_argument("missing time");
+            }
+            double time = std::stod(values.at("time"));
+            if (command == "add") {
+                if (values.count("job") == 0 || values.count("tasks") == 0) {
+                    throw std::invalid_argument("missing job or tasks");
+                }
+                scheduler.AddJob(time,
+                                 std::stoul(values.at("job")),
+                                 ParseTasks(values.at("tasks")),
+                                 values.count("due") ? std::stod(values.at("due")) : 0.0,
+                                 values.count("weight") ? std::stod(values.at("weight")) : 1.0);
+            } else if (command == "cancel") {
+                if (values.count("job") == 0) {
+                    throw std::invalid_argument("missing job");
+                }
+                scheduler.CancelJob(time, std::stoul(values.at("job")));
+            } else if (command == "advance") {
+                scheduler.Advance(time);
+            } else {
+                throw std::invalid_argument("unknown command " + command);
+            }
+
+            SearchBudget budget(configuration.time_limit > 0 ? std::chrono::milliseconds(configuration.time_limit)
+                                                             : SearchBudget::Clock::duration::max(),
+                                configuration.evaluation_limit);
+            double value = scheduler.Reoptimize(solver, budget, rng);
+            std::cout << "schedule time=" << scheduler.GetTime() << " value=" << value << " frozen=" << scheduler.GetNumberOfFrozenTasks()
+                      << " open=" << scheduler.GetNumberOfOpenTasks()
+                      << " time_ms=" << std::chrono::duration<double, std::milli>(budget.Elapsed()).count()
+                      << " evaluations=" << budget.GetEvaluations() << " machines=" << scheduler.GetNumberOfMachines() << '\n'
+                      << scheduler.SolutionSequence() << std::flush;
+        } catch (const std::exception& e) {
+            std::cout << "error message=" << e.what() << std::endl;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-stream [-s memetic|memetic-pr|memetic-ss|memetic-adaptive|ea|tabu|exact|auto] [-o makespan|twt] [-t milliseconds]
+    //                       [-e evaluations] [-seed seed]
+    Configuration configuration;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg(argv[i]);
+        std::string value(argv[i + 1]);
+        if (arg == "-s") {
+            configuration.solver_name = value;
+        } else if (arg == "-o") {
+            configuration.objective = value;
+        } else if (arg == "-t") {
+            configuration.time_limit = std::stol(value);
+        } else if (arg == "-e") {
+            configuration.evaluation_limit = std::stoull(value);
+        } else if (arg == "-seed") {
+            configuration.seed = std::stoull(value);
+        } else {
+            throw std::invalid_argument("unknown option " + arg);
+        }
+    }
+    if (configuration.objective != "makespan" && configuration.objective != "twt") {
+        throw std::invalid_argument("unknown objective " + configuration.objective);
+    }
+    ParseJSPSolverType(configuration.solver_name);
+
+    if (configuration.objective == "twt") {
+        Run<JSPTotalWeightedTardinessMinimizationSolution<ProblemType>>(configuration);
+    } else {
+        Run<JSPMakespanMinimizationSolution<ProblemType>>(configuration);
+    }
+    return 0;
+}
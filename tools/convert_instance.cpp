@@ -0,0 +1,34 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <problems/jsp/jsp.hpp>
+#include <problems/jsp/jsp_binary_instance.hpp>
+#include <problems/jsp/jsp_job.hpp>
+#include <problems/jsp/jsp_machine.hpp>
+#include <problems/jsp/jsp_readers.hpp>
+#include <problems/jsp/jsp_task.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+int main(int argc, char** argv)
+{
+    // usage: jobshop-convert [-d] instance output
+    // converts an instance in standard format (with due dates and weights if -d is given) to the binary format,
+    // the durations and due dates can be crisp or fuzzy
+    using JobType = JSPJob<TriangularFuzzyNumber<double>>;
+    using TaskType = JSPTask<TriangularFuzzyNumber<double>, JobType, JSPMachine>;
+
+    bool due_dates = argc > 1 && std::string(argv[1]) == "-d";
+    if (argc != (due_dates ? 4 : 3)) {
+        throw std::invalid_argument("Usage: jobshop-convert [-d] instance output");
+    }
+    std::string input(argv[due_dates ? 2 : 1]);
+    std::string output(argv[due_dates ? 3 : 2]);
+
+    const auto problem = due_dates ? read_standard_due_dates_file<TaskType, JobType, JSPMachine>(input)
+                                   : read_standard_file<TaskType, JobType, JSPMachine>(input);
+    JSPBinaryInstance::Write(problem, output, due_dates);
+    std::cout << input << " -> " << output << " (" << problem.GetNumberOfJobs() << " jobs, " << problem.GetNumberOfMachines() << " machines)"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file allocation_counter.hpp
+ * @author Pablo
+ * @brief Per-thread counter of dynamic memory allocations.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ALLOCATIONCOUNTER_HPP_
+#define ALLOCATIONCOUNTER_HPP_
+
+/**
+ * @brief Counts the dynamic memory allocations done by the current thread. The counter is only
+ * incremented if utils/count_allocations.hpp is included in the program, in other case it stays at zero.
+ * 
+ */
+class AllocationCounter
+{
+  private:
+    static inline thread_local unsigned long long allocations = 0; // allocations done by the current thread
+
+  public:
+    /**
+     * @brief Counts a new allocation in the current thread.
+     * 
+     */
+    static void Add()
+    {
+        allocations++;
+    }
+
+    /**
+     * @brief Returns the number of allocations done by the current thread.
+     * 
+     * @return the number of allocations done by the current thread.
+     */
+    static unsigned long long Get()
+    {
+        return allocations;
+    }
+};
+
+#endif /* ALLOCATIONCOUNTER_HPP_ */
@@ -11,6 +11,9 @@
 #ifndef CONTAINERUTILS_HPP_
 #define CONTAINERUTILS_HPP_
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
 /**
@@ -38,6 +41,73 @@ OutputIt filter_transform(InputIt first, InputIt last, OutputIt d_first, UnaryPr
     return d_first;
 }
 
+/**
+ * @brief Output iterator that applies a function object to each element before inserting it with another output iterator,
+ * so the elements are processed as soon as they are produced.
+ * 
+ * @tparam OutputIt type of the iterator to be used to insert the elements.
+ * @tparam UnaryOperation type of function object to be applied to the elements.
+ */
+template <class OutputIt, class UnaryOperation> class transform_output_iterator
+{
+  private:
+    OutputIt d_first; // iterator to be used to insert the elements
+    UnaryOperation unary_op; // function object to be applied to the elements
+
+  public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    /**
+     * @brief Constructs a new transform_output_iterator.
+     * 
+     * @param d_first iterator to be used to insert the elements.
+     * @param unary_op function object to be applied to the elements.
+     */
+    transform_output_iterator(OutputIt d_first, UnaryOperation unary_op) : d_first{d_first}, unary_op{std::move(unary_op)}
+    {}
+
+    template <typename T, typename = std::enable_if_t<!std::is_same<std::decay_t<T>, transform_output_iterator>::value>>
+    transform_output_iterator& operator=(T&& value)
+    {
+        *d_first++ = unary_op(std::forward<T>(value));
+        return *this;
+    }
+
+    transform_output_iterator& operator*()
+    {
+        return *this;
+    }
+
+    transform_output_iterator& operator++()
+    {
+        return *this;
+    }
+
+    transform_output_iterator& operator++(int)
+    {
+        return *this;
+    }
+};
+
+/**
+ * @brief Constructs a transform_output_iterator.
+ * 
+ * @tparam OutputIt type of the iterator to be used to insert the elements.
+ * @tparam UnaryOperation type of function object to be applied to the elements.
+ * @param d_first iterator to be used to insert the elements.
+ * @param unary_op function object to be applied to the elements.
+ * @return the transform_output_iterator.
+ */
+template <class OutputIt, class UnaryOperation>
+transform_output_iterator<OutputIt, UnaryOperation> make_transform_output_iterator(OutputIt d_first, UnaryOperation unary_op)
+{
+    return transform_output_iterator<OutputIt, UnaryOperation>(d_first, std::move(unary_op));
+}
+
 namespace
 {
     /**
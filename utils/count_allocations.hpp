@@ -0,0 +1,66 @@
+/**
+ * @file count_allocations.hpp
+ * @author Pablo
+ * @brief Replacement of the global allocation functions that counts the allocations.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef COUNTALLOCATIONS_HPP_
+#define COUNTALLOCATIONS_HPP_
+
+#include <cstdlib>
+#include <new>
+
+#include <utils/allocation_counter.hpp>
+
+// The replacement allocation functions cannot be inline, so this header must be
+// included in exactly one translation unit of the program.
+
+// GCC mistakes the frees of the pointers returned by the replaced operator new for mismatched deallocations
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    AllocationCounter::Add();
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif /* COUNTALLOCATIONS_HPP_ */
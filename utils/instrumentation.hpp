@@ -0,0 +1,258 @@
+/**
+ * @file instrumentation.hpp
+ * @author Pablo
+ * @brief Scoped timers and counters for the hot paths of the algorithms.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef INSTRUMENTATION_HPP_
+#define INSTRUMENTATION_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <ostream>
+
+#include <utils/allocation_counter.hpp>
+
+/**
+ * @brief Instrumented regions of the code.
+ * 
+ */
+enum class Probe : unsigned char
+{
+    EvaluateSolution, // GT::EvaluateSolution
+    Cross, // GOX::Cross
+    GetNeighbors, // GetNeighbors
+    ApplyMove, // ApplyMove of the solutions
+    UpdateHeadsAndTails // UpdateHeadsAndTails of the solutions (only when there are changes)
+};
+
+/**
+ * @brief Collects the calls, times and allocations of the instrumented regions. Each thread records in its
+ * own statistics, which are merged when the thread finishes. The report is printed to std::cerr at exit.
+ * 
+ */
+class Instrumentation
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t number_of_probes = 5; // number of instrumented regions
+    static constexpr std::size_t number_of_buckets = 496; // buckets of the histogram of durations
+
+    /**
+     * @brief Statistics of an instrumented region. The durations are kept in a logarithmic histogram
+     * with 8 buckets per power of two, so the percentiles have a relative error below 12.5%.
+     * 
+     */
+    struct ProbeStats
+    {
+        unsigned long long calls = 0; // number of calls
+        unsigned long long total = 0; // total time in nanoseconds
+        unsigned long long allocations = 0; // number of allocations
+        std::array<unsigned long long, number_of_buckets> histogram{}; // histogram of the durations
+
+        /**
+         * @brief Returns the bucket of the histogram of a duration.
+         * 
+         * @param nanoseconds duration.
+         * @return the bucket of the histogram of the duration.
+         */
+        static std::size_t Bucket(unsigned long long nanoseconds)
+        {
+            if (nanoseconds < 16) {
+                return nanoseconds;
+            }
+            std::size_t exponent = 63;
+            while ((nanoseconds >> exponent) == 0) {
+                exponent--;
+            }
+            return 16 + (exponent - 4) * 8 + ((nanoseconds >> (exponent - 3)) & 7);
+        }
+
+        /**
+         * @brief Returns the lower bound of the durations of a bucket.
+         * 
+         * @param bucket bucket of the histogram.
+         * @return the lower bound of the durations of the bucket.
+         */
+        static unsigned long long LowerBound(std::size_t bucket)
+        {
+            if (bucket < 16) {
+                return bucket;
+            }
+            std::size_t exponent = (bucket - 16) / 8 + 4;
+            return (8ULL + (bucket - 16) % 8) << (exponent - 3);
+        }
+
+        /**
+         * @brief Records a call.
+         * 
+         * @param nanoseconds duration of the call.
+         * @param new_allocations allocations done during the call.
+         */
+        void Add(unsigned long long nanoseconds, unsigned long long new_allocations)
+        {
+            calls++;
+            total += nanoseconds;
+            allocations += new_allocations;
+            histogram[Bucket(nanoseconds)]++;
+        }
+
+        /**
+         * @brief Adds the statistics of another region.
+         * 
+         * @param other statistics to be added.
+         */
+        void Merge(const ProbeStats& other)
+        {
+            calls += other.calls;
+            total += other.total;
+            allocations += other.allocations;
+            for (std::size_t i = 0; i < number_of_buckets; i++) {
+                histogram[i] += other.histogram[i];
+            }
+        }
+
+        /**
+         * @brief Returns an approximation of a percentile of the durations.
+         * 
+         * @param percentile percentile, between 0 and 1.
+         * @return the lower bound of the bucket where the percentile lies, in nanoseconds.
+         */
+        unsigned long long Percentile(double percentile) const
+        {
+            unsigned long long accumulated = 0;
+            for (std::size_t i = 0; i < number_of_buckets; i++) {
+                accumulated += histogram[i];
+                if (accumulated > 0 && accumulated >= percentile * calls) {
+                    return LowerBound(i);
+                }
+            }
+            return 0;
+        }
+    };
+
+  private:
+    // aggregated statistics of the finished threads, the report is printed when it is destroyed
+    struct Registry
+    {
+        std::mutex mutex;
+        std::array<ProbeStats, number_of_probes> probes;
+
+        ~Registry()
+        {
+            Report(std::cerr, probes);
+        }
+    };
+
+    // statistics of a thread, merged in the registry when the thread finishes
+    struct ThreadStats
+    {
+        std::array<ProbeStats, number_of_probes> probes;
+
+        ThreadStats()
+        {
+            GetRegistry(); // the registry has to outlive the statistics of the threads
+        }
+
+        ~ThreadStats()
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (std::size_t i = 0; i < number_of_probes; i++) {
+                registry.probes[i].Merge(probes[i]);
+            }
+        }
+    };
+
+    static Registry& GetRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    static ThreadStats& GetThreadStats()
+    {
+        thread_local ThreadStats stats;
+        return stats;
+    }
+
+  public:
+    /**
+     * @brief Records a call to an instrumented region in the statistics of the current thread.
+     * 
+     * @param probe instrumented region.
+     * @param nanoseconds duration of the call.
+     * @param allocations allocations done during the call.
+     */
+    static void Record(Probe probe, unsigned long long nanoseconds, unsigned long long allocations)
+    {
+        GetThreadStats().probes[static_cast<std::size_t>(probe)].Add(nanoseconds, allocations);
+    }
+
+    /**
+     * @brief Prints a report with the calls, total time, median and 99th percentile of the durations and allocations
+     * of each instrumented region. The times of nested regions are included in the times of the outer regions.
+     * 
+     * @param os stream where the report will be printed.
+     * @param probes statistics of the instrumented regions.
+     */
+    static void Report(std::ostream& os, const std::array<ProbeStats, number_of_probes>& probes)
+    {
+        static constexpr const char* names[number_of_probes] = {"EvaluateSolution", "Cross", "GetNeighbors", "ApplyMove", "UpdateHeadsAndTails"};
+        os << std::left << std::setw(20) << "probe" << std::right << std::setw(14) << "calls" << std::setw(14) << "total_ms" << std::setw(12)
+           << "p50_ns" << std::setw(12) << "p99_ns" << std::setw(14) << "allocations" << std::endl;
+        for (std::size_t i = 0; i < number_of_probes; i++) {
+            os << std::left << std::setw(20) << names[i] << std::right << std::setw(14) << probes[i].calls << std::setw(14) << std::fixed
+               << std::setprecision(3) << probes[i].total / 1e6 << std::setw(12) << probes[i].Percentile(0.5) << std::setw(12)
+               << probes[i].Percentile(0.99) << std::setw(14) << probes[i].allocations << std::endl;
+        }
+    }
+};
+
+/**
+ * @brief Records the time and allocations between its construction and its destruction.
+ * 
+ */
+class ScopedTimer
+{
+  private:
+    Probe probe; // instrumented region
+    unsigned long long allocations; // allocations done by the thread at construction
+    Instrumentation::Clock::time_point start; // instant of the construction
+
+  public:
+    /**
+     * @brief Constructs a new ScopedTimer.
+     * 
+     * @param probe instrumented region.
+     */
+    explicit ScopedTimer(Probe probe) : probe{probe}, allocations{AllocationCounter::Get()}, start{Instrumentation::Clock::now()} {}
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    ~ScopedTimer()
+    {
+        auto end = Instrumentation::Clock::now();
+        Instrumentation::Record(
+            probe, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), AllocationCounter::Get() - allocations);
+    }
+};
+
+// the instrumentation is compiled only if JSP_INSTRUMENTATION is defined
+#ifdef JSP_INSTRUMENTATION
+#define JSP_SCOPED_TIMER(probe) const ScopedTimer scoped_timer(probe)
+#else
+#define JSP_SCOPED_TIMER(probe)
+#endif
+
+#endif /* INSTRUMENTATION_HPP_ */
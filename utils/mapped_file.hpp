@@ -0,0 +1,156 @@
+/**
+ * @file mapped_file.hpp
+ * @author Pablo
+ * @brief Read-only view of the contents of a file.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef MAPPEDFILE_HPP_
+#define MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define JSP_HAS_MMAP
+#endif
+
+/**
+ * @brief Read-only view of the contents of a file. The file is memory-mapped when the platform supports it,
+ * so its contents are not copied, and read into a buffer in other case.
+ * 
+ */
+class MappedFile
+{
+  private:
+    const char* contents; // first byte of the contents of the file
+    std::size_t length; // number of bytes of the file
+    bool mapped; // true if the contents are memory-mapped, false if they are in the buffer
+    std::string buffer; // contents of the file when it cannot be memory-mapped
+
+    void Release()
+    {
+#ifdef JSP_HAS_MMAP
+        if (mapped) {
+            munmap(const_cast<char*>(contents), length);
+        }
+#endif
+        contents = nullptr;
+        length = 0;
+        mapped = false;
+    }
+
+  public:
+    /**
+     * @brief Constructs a new MappedFile.
+     * 
+     * @param path path of the file.
+     */
+    explicit MappedFile(const std::string& path) : contents{nullptr}, length{0}, mapped{false}
+    {
+#ifdef JSP_HAS_MMAP
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::invalid_argument("cannot open " + path);
+        }
+        struct stat status;
+        if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0) {
+            void* address = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                madvise(address, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+                contents = static_cast<const char*>(address);
+                length = static_cast<std::size_t>(status.st_size);
+                mapped = true;
+            }
+        }
+        close(fd);
+        if (mapped) {
+            return;
+        }
+#endif
+        std::ifstream is(path, std::ios::binary);
+        if (!is) {
+            throw std::invalid_argument("cannot open " + path);
+        }
+        buffer.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+        contents = buffer.data();
+        length = buffer.size();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept :
+        contents{std::exchange(other.contents, nullptr)},
+        length{std::exchange(other.length, 0)},
+        mapped{std::exchange(other.mapped, false)},
+        buffer{std::move(other.buffer)}
+    {
+        if (!mapped) {
+            contents = buffer.data();
+        }
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            Release();
+            contents = std::exchange(other.contents, nullptr);
+            length = std::exchange(other.length, 0);
+            mapped = std::exchange(other.mapped, false);
+            buffer = std::move(other.buffer);
+            if (!mapped) {
+                contents = buffer.data();
+            }
+        }
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        Release();
+    }
+
+    /**
+     * @brief Returns the first byte of the contents of the file.
+     * 
+     * @return the first byte of the contents of the file.
+     */
+    const char* begin() const
+    {
+        return contents;
+    }
+
+    /**
+     * @brief Returns the byte past the last byte of the contents of the file.
+     * 
+     * @return the byte past the last byte of the contents of the file.
+     */
+    const char* end() const
+    {
+        return contents + length;
+    }
+
+    /**
+     * @brief Returns the number of bytes of the file.
+     * 
+     * @return the number of bytes of the file.
+     */
+    std::size_t size() const
+    {
+        return length;
+    }
+};
+
+#endif /* MAPPEDFILE_HPP_ */
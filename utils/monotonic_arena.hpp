@@ -0,0 +1,102 @@
+/**
+ * @file monotonic_arena.hpp
+ * @author Pablo
+ * @brief Monotonic memory resource that is reset as a whole.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef MONOTONICARENA_HPP_
+#define MONOTONICARENA_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * @brief Memory resource for the short-lived containers of an iteration of a search. It allocates by bumping a pointer in
+ * a buffer, deallocations do nothing, and Reset frees everything at once. When the buffer is full a new block is allocated;
+ * Reset replaces the blocks with a single buffer large enough for all of them, so once the arena has grown to the peak usage
+ * of an iteration, the following iterations do not allocate at all. Unlike std::pmr::monotonic_buffer_resource, whose release
+ * frees the blocks it has grown, the grown capacity is kept between resets.
+ * 
+ * The containers that use the arena must be destroyed before it is reset. Their copies use the default resource (see
+ * std::pmr::polymorphic_allocator::select_on_container_copy_construction), so they can outlive it.
+ * 
+ */
+class MonotonicArena : public std::pmr::memory_resource
+{
+  private:
+    std::unique_ptr<std::byte[]> buffer; // main buffer
+    std::size_t capacity; // size of the main buffer
+    std::vector<std::unique_ptr<std::byte[]>> blocks; // blocks allocated since the last reset, when the main buffer was full
+    std::byte* current; // first free byte of the block in use
+    std::size_t available; // free bytes of the block in use
+    std::size_t requested; // bytes requested since the last reset, including the padding
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void* pointer = current;
+        std::size_t space = available;
+        if (std::align(alignment, bytes, pointer, space) == nullptr) {
+            std::size_t size = std::max(2 * std::max(capacity, requested), bytes + alignment);
+            blocks.push_back(std::make_unique<std::byte[]>(size));
+            current = blocks.back().get();
+            available = size;
+            pointer = current;
+            space = available;
+            std::align(alignment, bytes, pointer, space);
+        }
+        requested += available - space + bytes;
+        current = static_cast<std::byte*>(pointer) + bytes;
+        available = space - bytes;
+        return pointer;
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+  public:
+    /**
+     * @brief Constructs a new MonotonicArena.
+     * 
+     * @param capacity initial size of the buffer in bytes.
+     */
+    explicit MonotonicArena(std::size_t capacity = 64 * 1024) :
+        buffer{std::make_unique<std::byte[]>(capacity)},
+        capacity{capacity},
+        current{buffer.get()},
+        available{capacity},
+        requested{0}
+    {}
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * @brief Frees all the memory allocated since the last reset. If the buffer was not large enough, it is replaced by one
+     * that can hold all the allocations of the last period.
+     * 
+     */
+    void Reset()
+    {
+        if (!blocks.empty()) {
+            capacity = std::max(2 * capacity, requested);
+            blocks.clear();
+            buffer = std::make_unique<std::byte[]>(capacity);
+        }
+        current = buffer.get();
+        available = capacity;
+        requested = 0;
+    }
+};
+
+#endif /* MONOTONICARENA_HPP_ */
@@ -0,0 +1,48 @@
+/**
+ * @file objective_key.hpp
+ * @author Pablo
+ * @brief Keys to rank the values of the objective functions.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef OBJECTIVEKEY_HPP_
+#define OBJECTIVEKEY_HPP_
+
+#include <utils/triangular_fuzzy_number.hpp>
+
+/**
+ * @brief Key used to rank the values of an objective function to be minimized: a value is better than another one if its key
+ * is lower. Integral and floating point values are their own key, so they are compared exactly.
+ * 
+ * @tparam T type of the values of the objective function.
+ */
+template <typename T> struct ObjectiveKey
+{
+    using type = T;
+
+    static const T& Get(const T& value)
+    {
+        return value;
+    }
+};
+
+/**
+ * @brief Key used to rank fuzzy values of an objective function, their expected value, which is the ranking
+ * used by the comparison operators of TriangularFuzzyNumber.
+ * 
+ * @tparam T type of the components of the fuzzy numbers.
+ */
+template <typename T> struct ObjectiveKey<TriangularFuzzyNumber<T>>
+{
+    using type = T;
+
+    static T Get(const TriangularFuzzyNumber<T>& value)
+    {
+        return value.ExpectedValue();
+    }
+};
+
+#endif /* OBJECTIVEKEY_HPP_ */
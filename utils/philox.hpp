@@ -0,0 +1,205 @@
+/**
+ * @file philox.hpp
+ * @author Pablo
+ * @brief Counter-based random number generator.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef PHILOX_HPP_
+#define PHILOX_HPP_
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+/**
+ * @brief Scrambles a 64-bit value with the finalizer of SplitMix64.
+ * 
+ * @param value value to be scrambled.
+ * @return the scrambled value.
+ */
+constexpr std::uint64_t SplitMix64(std::uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+ * Each output block is a function of a key and a counter, so the generator is a few bytes long, copying it is cheap
+ * and independent streams are obtained by changing the key or the high half of the counter.
+ * It satisfies the UniformRandomBitGenerator requirements, so it can be used with the standard distributions.
+ * 
+ */
+class Philox4x32
+{
+  public:
+    using result_type = std::uint32_t;
+
+  private:
+    std::array<std::uint32_t, 2> key; // key of the generator, derived from the seed
+    std::array<std::uint32_t, 4> counter; // position (two low words) and stream (two high words)
+    std::array<std::uint32_t, 4> block; // last output block
+    unsigned int index; // next value of the block to be returned
+
+    static std::uint32_t MulHiLo(std::uint32_t a, std::uint32_t b, std::uint32_t& high)
+    {
+        std::uint64_t product = static_cast<std::uint64_t>(a) * b;
+        high = static_cast<std::uint32_t>(product >> 32);
+        return static_cast<std::uint32_t>(product);
+    }
+
+    /**
+     * @brief Calculates the output block of the current counter and increments the counter.
+     * 
+     */
+    void Generate()
+    {
+        std::array<std::uint32_t, 4> x = counter;
+        std::array<std::uint32_t, 2> k = key;
+        for (int round = 0; round < 10; round++) {
+            std::uint32_t high0;
+            std::uint32_t high1;
+            std::uint32_t low0 = MulHiLo(0xD2511F53U, x[0], high0);
+            std::uint32_t low1 = MulHiLo(0xCD9E8D57U, x[2], high1);
+            x = {high1 ^ x[1] ^ k[0], low1, high0 ^ x[3] ^ k[1], low0};
+            k[0] += 0x9E3779B9U;
+            k[1] += 0xBB67AE85U;
+        }
+        block = x;
+        index = 0;
+        if (++counter[0] == 0) {
+            ++counter[1];
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs a new Philox4x32.
+     * 
+     * @param seed seed of the generator.
+     * @param stream stream of the generator, generators with the same seed and different streams are independent.
+     */
+    explicit Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0) :
+        key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+        counter{0, 0, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)},
+        block{},
+        index{4}
+    {}
+
+    /**
+     * @brief Returns an independent generator for a substream, for instance for a thread or an individual.
+     * The substreams of a substream are also independent, so streams can be nested.
+     * 
+     * @param id identifier of the substream.
+     * @return the generator of the substream.
+     */
+    Philox4x32 Substream(std::uint64_t id) const
+    {
+        std::uint64_t seed = static_cast<std::uint64_t>(key[1]) << 32 | key[0];
+        std::uint64_t stream = static_cast<std::uint64_t>(counter[3]) << 32 | counter[2];
+        return Philox4x32(SplitMix64(seed ^ SplitMix64(stream)), id);
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()()
+    {
+        if (index == 4) {
+            Generate();
+        }
+        return block[index++];
+    }
+
+    /**
+     * @brief Advances the generator.
+     * 
+     * @param n number of values to be skipped.
+     */
+    void discard(unsigned long long n)
+    {
+        while (n > 0 && index < 4) {
+            index++;
+            n--;
+        }
+        std::uint64_t position = (static_cast<std::uint64_t>(counter[1]) << 32 | counter[0]) + n / 4;
+        counter[0] = static_cast<std::uint32_t>(position);
+        counter[1] = static_cast<std::uint32_t>(position >> 32);
+        if (n % 4 != 0) {
+            Generate();
+            index = n % 4;
+        }
+    }
+
+    bool operator==(const Philox4x32& other) const
+    {
+        return key == other.key && counter == other.counter && index == other.index && (index == 4 || block == other.block);
+    }
+
+    bool operator!=(const Philox4x32& other) const
+    {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Writes the state of the generator as decimal numbers separated by spaces, as the standard engines do.
+     * 
+     * @param os output stream.
+     * @param generator generator to be written.
+     * @return the output stream.
+     */
+    friend std::ostream& operator<<(std::ostream& os, const Philox4x32& generator)
+    {
+        os << generator.key[0] << ' ' << generator.key[1];
+        for (std::uint32_t word: generator.counter) {
+            os << ' ' << word;
+        }
+        for (std::uint32_t word: generator.block) {
+            os << ' ' << word;
+        }
+        return os << ' ' << generator.index;
+    }
+
+    /**
+     * @brief Reads the state of a generator written by operator<<. If the state cannot be read the generator is not modified.
+     * 
+     * @param is input stream.
+     * @param generator generator where the state is read.
+     * @return the input stream.
+     */
+    friend std::istream& operator>>(std::istream& is, Philox4x32& generator)
+    {
+        Philox4x32 state;
+        is >> state.key[0] >> state.key[1];
+        for (std::uint32_t& word: state.counter) {
+            is >> word;
+        }
+        for (std::uint32_t& word: state.block) {
+            is >> word;
+        }
+        is >> state.index;
+        if (is && state.index <= 4) {
+            generator = state;
+        } else {
+            is.setstate(std::ios::failbit);
+        }
+        return is;
+    }
+};
+
+#endif /* PHILOX_HPP_ */
@@ -0,0 +1,142 @@
+/**
+ * @file text_scanner.hpp
+ * @author Pablo
+ * @brief Forward scanner of numbers in a text buffer.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef TEXTSCANNER_HPP_
+#define TEXTSCANNER_HPP_
+
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <utils/template_utils.hpp>
+#include <utils/triangular_fuzzy_number.hpp>
+
+/**
+ * @brief Reads whitespace-separated numbers from a text buffer in a single forward pass with std::from_chars,
+ * without copying the buffer nor using streams. Triangular fuzzy numbers are read from triples "(a,b,c)", and
+ * a crisp number is read as the degenerate triple "(a,a,a)".
+ * 
+ */
+class TextScanner
+{
+  private:
+    const char* current; // next character to be read
+    const char* first; // first character of the buffer
+    const char* last; // character past the last character of the buffer
+
+    [[noreturn]] void Fail(const char* expected) const
+    {
+        throw std::invalid_argument(std::string("expected ") + expected + " at offset " + std::to_string(current - first));
+    }
+
+    void SkipWhitespace()
+    {
+        while (current != last && (*current == ' ' || *current == '\t' || *current == '\n' || *current == '\r' || *current == '\v' ||
+                                   *current == '\f')) {
+            current++;
+        }
+    }
+
+    void Expect(char c)
+    {
+        SkipWhitespace();
+        if (current == last || *current != c) {
+            const char expected[] = {'\'', c, '\'', '\0'};
+            Fail(expected);
+        }
+        current++;
+    }
+
+    template <typename T> void ReadNumber(T& value)
+    {
+        SkipWhitespace();
+        const char* begin = current;
+        if constexpr (std::is_floating_point_v<T>) {
+            if (begin != last && *begin == '+') { // accepted by the streams but not by std::from_chars
+                begin++;
+            }
+        }
+        auto [end, error] = std::from_chars(begin, last, value);
+        if (error != std::errc()) {
+            Fail("a number");
+        }
+        current = end;
+    }
+
+  public:
+    /**
+     * @brief Constructs a new TextScanner.
+     * 
+     * @param first first character of the buffer.
+     * @param last character past the last character of the buffer.
+     */
+    TextScanner(const char* first, const char* last) : current{first}, first{first}, last{last} {}
+
+    /**
+     * @brief Reads the next value of the buffer.
+     * 
+     * @tparam T type of the value, an arithmetic type or a triangular fuzzy number.
+     * @param value where the value read is stored.
+     */
+    template <typename T> void Read(T& value)
+    {
+        if constexpr (is_specialization<T, TriangularFuzzyNumber>::value) {
+            using InnerType = decltype(value.GetSmallest());
+            InnerType smallest;
+            InnerType most_probable;
+            InnerType largest;
+            SkipWhitespace();
+            if (current != last && *current == '(') {
+                current++;
+                ReadNumber(smallest);
+                Expect(',');
+                ReadNumber(most_probable);
+                Expect(',');
+                ReadNumber(largest);
+                Expect(')');
+            } else {
+                ReadNumber(smallest);
+                most_probable = largest = smallest;
+            }
+            value = T(smallest, most_probable, largest);
+        } else {
+            ReadNumber(value);
+        }
+    }
+
+    /**
+     * @brief Reads the next value of the buffer.
+     * 
+     * @tparam T type of the value, an arithmetic type or a triangular fuzzy number.
+     * @return the value read.
+     */
+    template <typename T> T Read()
+    {
+        T value;
+        Read(value);
+        return value;
+    }
+
+    /**
+     * @brief Checks if only whitespace remains in the buffer.
+     * 
+     * @return true if only whitespace remains in the buffer, false in other case.
+     */
+    bool AtEnd()
+    {
+        SkipWhitespace();
+        return current == last;
+    }
+};
+
+#endif /* TEXTSCANNER_HPP_ */
@@ -0,0 +1,183 @@
+/**
+ * @file thread_pool.hpp
+ * @author Pablo
+ * @brief Fixed-size pool of worker threads with work stealing.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef THREADPOOL_HPP_
+#define THREADPOOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Fixed-size pool of worker threads with work stealing. Each worker has its own queue: the tasks submitted
+ * from outside the pool are distributed among the queues in round robin, and the tasks submitted by a worker go to its
+ * own queue. A worker takes the oldest task of its queue and, when its queue is empty, steals the oldest task of the
+ * queue of another worker, so the tasks are started approximately in submission order, and submitting them from the
+ * most to the least expensive balances the load.
+ * The destructor waits until all the submitted tasks have finished.
+ * 
+ */
+class ThreadPool
+{
+  private:
+    // queue of a worker
+    struct WorkerQueue
+    {
+        std::mutex mutex; // protects the tasks
+        std::deque<std::function<void()>> tasks; // tasks waiting in the queue
+    };
+
+    std::mutex mutex; // protects the stop flag and the increments of the pending tasks
+    std::condition_variable available; // notified when a task is queued or the pool stops
+    std::atomic<std::size_t> pending; // tasks waiting in the queues
+    std::atomic<std::size_t> next; // queue where the next external task will be pushed
+    bool stop; // true when the pool is being destroyed
+    std::vector<std::unique_ptr<WorkerQueue>> queues; // queues of the workers
+    std::vector<std::thread> workers; // worker threads, constructed the last
+
+    // pool and queue of the worker that runs in the current thread
+    static ThreadPool*& CurrentPool()
+    {
+        thread_local ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static std::size_t& CurrentQueue()
+    {
+        thread_local std::size_t queue = 0;
+        return queue;
+    }
+
+    /**
+     * @brief Takes the oldest task of a queue.
+     * 
+     * @param index index of the queue.
+     * @param task where the task is stored.
+     * @return true if a task was taken, false if the queue was empty.
+     */
+    bool TryPop(std::size_t index, std::function<void()>& task)
+    {
+        WorkerQueue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        pending--;
+        return true;
+    }
+
+    void Work(std::size_t index)
+    {
+        CurrentPool() = this;
+        CurrentQueue() = index;
+        while (true) {
+            std::function<void()> task;
+            bool found = TryPop(index, task);
+            for (std::size_t i = 1; !found && i < queues.size(); i++) {
+                found = TryPop((index + i) % queues.size(), task);
+            }
+            if (found) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this]() { return stop || pending > 0; });
+            if (stop && pending == 0) {
+                return;
+            }
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs a new ThreadPool.
+     * 
+     * @param threads number of worker threads, 0 to use one per hardware thread.
+     */
+    explicit ThreadPool(std::size_t threads = 0) : pending{0}, next{0}, stop{false}
+    {
+        if (threads == 0) {
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        for (std::size_t i = 0; i < threads; i++) {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; i++) {
+            workers.emplace_back(&ThreadPool::Work, this, i);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        available.notify_all();
+        for (auto& worker: workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Returns the number of worker threads.
+     * 
+     * @return the number of worker threads.
+     */
+    std::size_t Size() const
+    {
+        return workers.size();
+    }
+
+    /**
+     * @brief Submits a task to be run by a worker.
+     * 
+     * @tparam Function type of the task.
+     * @param function task to be run.
+     * @return a future with the result of the task, or the exception it threw.
+     */
+    template <typename Function> std::future<std::invoke_result_t<std::decay_t<Function>>> Submit(Function&& function)
+    {
+        using Result = std::invoke_result_t<std::decay_t<Function>>;
+        // std::function requires copyable targets, so the packaged task is shared
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+        auto future = task->get_future();
+        std::size_t index = CurrentPool() == this ? CurrentQueue() : next++ % queues.size();
+        {
+            // counted before it is queued, so the counter never goes below the number of queued tasks
+            std::lock_guard<std::mutex> lock(mutex);
+            pending++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.emplace_back([task]() { (*task)(); });
+        }
+        available.notify_one();
+        return future;
+    }
+};
+
+#endif /* THREADPOOL_HPP_ */
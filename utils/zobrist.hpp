@@ -0,0 +1,42 @@
+/**
+ * @file zobrist.hpp
+ * @author Pablo
+ * @brief Zobrist keys of the arcs of a disjunctive graph.
+ * @version 0.1
+ * @date 18-10-2026
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef ZOBRIST_HPP_
+#define ZOBRIST_HPP_
+
+#include <cstdint>
+
+/**
+ * @brief Zobrist hashing of the machine orders of a schedule. The hash of a schedule is the exclusive or of the keys of its
+ * arcs (each pair of consecutive tasks of a machine), so an exchange of tasks updates it in constant time by removing
+ * the keys of the old arcs and adding the keys of the new ones. The keys are not stored in a table of random numbers but
+ * derived from the identifiers of the tasks with the SplitMix64 finalizer, which behaves as a random function, so the
+ * hashes are the same for every schedule of every problem without any state.
+ * 
+ */
+struct Zobrist
+{
+    /**
+     * @brief Returns the key of an arc.
+     * 
+     * @param from identifier of the task processed first.
+     * @param to identifier of the task processed next.
+     * @return the key of the arc.
+     */
+    static constexpr std::uint64_t Arc(unsigned int from, unsigned int to)
+    {
+        std::uint64_t z = (static_cast<std::uint64_t>(from) << 32 | to) + 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+};
+
+#endif /* ZOBRIST_HPP_ */